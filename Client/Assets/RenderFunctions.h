@@ -19,6 +19,16 @@
 
 struct rr_renderer;
 
+// namespaces for the keys handed to rr_renderer_draw_cached
+enum rr_sprite_cache_kind
+{
+    rr_sprite_cache_kind_mob = 1,
+    rr_sprite_cache_kind_hell_creek_mob,
+    rr_sprite_cache_kind_petal,
+    rr_sprite_cache_kind_glyph,
+    rr_sprite_cache_kind_glyph_stroke
+};
+
 void rr_renderer_draw_petal(struct rr_renderer *, uint8_t, uint8_t);
 void rr_renderer_draw_static_petal(struct rr_renderer *, uint8_t, uint8_t,
                                    uint8_t);
@@ -43,5 +53,18 @@ void rr_renderer_draw_web(struct rr_renderer *);
 void rr_renderer_petal_cache_init();
 void rr_renderer_background_cache_init();
 void rr_renderer_text_cache_init();
+// outlined text (0xff222222 stroke, size * 0.12 wide) laid out in c and drawn
+// glyph by glyph from the sprite atlas. align and baseline take the same
+// values as rr_renderer_set_text_align/baseline
+void rr_renderer_draw_text(struct rr_renderer *, char const *, float, float,
+                           float, uint32_t, uint8_t, uint8_t);
+// same with the stroke color given after the fill
+void rr_renderer_draw_stroked_text(struct rr_renderer *, char const *, float,
+                                   float, float, uint32_t, uint32_t, uint8_t,
+                                   uint8_t);
+// width of the text at size 1, kerning included
+float rr_renderer_measure_text(char const *);
+void rr_renderer_draw_damage_number(struct rr_renderer *, uint32_t, float,
+                                    float);
 void rr_renderer_mob_cache_init();
 void rr_renderer_tiles_init();
\ No newline at end of file
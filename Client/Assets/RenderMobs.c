@@ -25,10 +25,26 @@
 // Forward declaration for hell creek mob rendering
 void rr_renderer_draw_hell_creek_mob(struct rr_renderer *, uint8_t, float, float, uint8_t);
 
+#define HELL_CREEK_PHASES 16
+#define HELL_CREEK_SPRITE_SIZE 120
+
+struct hell_creek_sprite
+{
+    uint8_t id;
+    uint8_t flags;
+    float tick;
+};
+
 // head, body, legs, tail, IN THAT ORDER
 
 struct rr_renderer_spritesheet mob_sprites[rr_mob_id_max];
 struct rr_renderer_spritesheet friendly_trex_spritesheet;
+
+static void draw_sprite_bounds(struct rr_renderer *renderer, void *captures)
+{
+    ((struct rr_sprite_bounds *)captures)->render(renderer);
+}
+
 void render_sprite(struct rr_renderer *renderer, uint8_t id, uint32_t pos,
                    uint8_t flags)
 {
@@ -39,7 +55,44 @@ void render_sprite(struct rr_renderer *renderer, uint8_t id, uint32_t pos,
                                      : &mob_sprites[id],
                                  pos);
     else
-        mob_sprites[id].sprites[pos].render(renderer);
+    {
+        // filtered (damage flash, friendly tint) sprites go through the atlas
+        struct rr_sprite_bounds *bounds = &mob_sprites[id].sprites[pos];
+        rr_renderer_draw_cached(renderer,
+                                rr_sprite_cache_kind_mob << 24 | id << 8 | pos,
+                                bounds->w, bounds->h, draw_sprite_bounds,
+                                bounds);
+    }
+}
+
+static void draw_hell_creek_sprite(struct rr_renderer *renderer,
+                                   void *captures)
+{
+    struct hell_creek_sprite *sprite = captures;
+    rr_renderer_draw_hell_creek_mob(renderer, sprite->id, sprite->tick, 0,
+                                    sprite->flags);
+}
+
+// these ignore the color filter and only depend on the animation tick and
+// the friendly flag, so a handful of cached phases per mob stand in for the
+// procedural drawing
+static void render_hell_creek_mob(struct rr_renderer *renderer, uint8_t id,
+                                  float raw_animation_tick, uint8_t flags)
+{
+    float phase = floorf(fmodf(raw_animation_tick, 2 * M_PI) /
+                         (2 * M_PI) * HELL_CREEK_PHASES);
+    if (phase < 0)
+        phase += HELL_CREEK_PHASES;
+    struct hell_creek_sprite sprite = {
+        id, flags & 2, (phase + 0.5f) * 2 * M_PI / HELL_CREEK_PHASES};
+    rr_renderer_reset_color_filter(renderer);
+    // phases take the low 4 bits, the friendly flag sits just above them
+    rr_renderer_draw_cached(
+        renderer,
+        rr_sprite_cache_kind_hell_creek_mob << 24 | id << 8 |
+            (flags & 2) << 3 | (uint32_t)phase,
+        HELL_CREEK_SPRITE_SIZE, HELL_CREEK_SPRITE_SIZE, draw_hell_creek_sprite,
+        &sprite);
 }
 
 void rr_renderer_draw_mob(struct rr_renderer *renderer, uint8_t id,
@@ -82,7 +135,7 @@ void rr_renderer_draw_mob(struct rr_renderer *renderer, uint8_t id,
     case rr_mob_id_meteor:
     case rr_mob_id_quetzalcoatlus:
     case rr_mob_id_edmontosaurus:
-        rr_renderer_draw_hell_creek_mob(renderer, id, raw_animation_tick, turning_value, flags);
+        render_hell_creek_mob(renderer, id, raw_animation_tick, flags);
         break;
     case rr_mob_id_beehive:
         rr_renderer_scale(renderer, 0.4f);
@@ -16,6 +16,7 @@
 #include <Client/Assets/RenderFunctions.h>
 
 #include <math.h>
+#include <string.h>
 
 #include <Client/Renderer/Renderer.h>
 #include <Shared/StaticData.h>
@@ -25,6 +26,16 @@ struct rr_renderer text_cache;
 float PETAL_TEXT_LENGTHS[rr_petal_id_max];
 float RARITY_TEXT_LENGTHS[rr_rarity_id_max];
 float MOB_TEXT_LENGTHS[rr_mob_id_max];
+// printable ascii advances at size 1, measured once the font is in
+static float GLYPH_ADVANCES[128];
+static uint8_t glyphs_measured = 0;
+// pair kerning at size 1, measured the first time a pair shows up
+#define GLYPH_COUNT ('~' - ' ' + 1)
+static float GLYPH_KERNING[GLYPH_COUNT * GLYPH_COUNT];
+static uint8_t kerning_measured[GLYPH_COUNT * GLYPH_COUNT];
+
+// glyphs are rasterized at this size and scaled, the atlas picks the zoom
+#define GLYPH_SIZE 32
 
 void rr_renderer_draw_petal_name(struct rr_renderer *renderer, uint8_t id,
                                  float size, int8_t h, int8_t v)
@@ -59,8 +70,183 @@ void rr_renderer_draw_rarity_name(struct rr_renderer *renderer, uint8_t id,
     rr_renderer_scale(renderer, 10 / size);
 }
 
+struct glyph
+{
+    uint32_t color;
+    uint8_t stroke;
+    char text[2];
+};
+
+// stroke and fill are separate sprites so a whole string can be stroked
+// before any of it is filled, like strokeText then fillText would
+static void draw_glyph(struct rr_renderer *renderer, void *captures)
+{
+    struct glyph *glyph = captures;
+    rr_renderer_set_text_size(renderer, GLYPH_SIZE);
+    rr_renderer_set_text_align(renderer, 1);
+    rr_renderer_set_text_baseline(renderer, 1);
+    if (glyph->stroke)
+    {
+        rr_renderer_set_stroke(renderer, glyph->color);
+        rr_renderer_set_line_width(renderer, GLYPH_SIZE * 0.12);
+        rr_renderer_stroke_text(renderer, glyph->text, 0, 0);
+    }
+    else
+    {
+        rr_renderer_set_fill(renderer, glyph->color);
+        rr_renderer_fill_text(renderer, glyph->text, 0, 0);
+    }
+}
+
+static void measure_glyphs()
+{
+    char glyph[2] = {0};
+    for (uint8_t c = ' '; c < 127; ++c)
+    {
+        glyph[0] = c;
+        GLYPH_ADVANCES[c] = rr_renderer_get_text_size(glyph);
+    }
+    memset(kerning_measured, 0, sizeof kerning_measured);
+    glyphs_measured = 1;
+}
+
+static float glyph_kerning(uint8_t a, uint8_t b)
+{
+    uint32_t pair = (a - ' ') * GLYPH_COUNT + (b - ' ');
+    if (!kerning_measured[pair])
+    {
+        char text[3] = {a, b, 0};
+        GLYPH_KERNING[pair] = rr_renderer_get_text_size(text) -
+                              GLYPH_ADVANCES[a] - GLYPH_ADVANCES[b];
+        kerning_measured[pair] = 1;
+    }
+    return GLYPH_KERNING[pair];
+}
+
+// anything outside printable ascii (utf-8 nicknames) is left to the browser
+static uint8_t is_plain_text(char const *text)
+{
+    for (; *text; ++text)
+        if ((uint8_t)*text < ' ' || (uint8_t)*text > '~')
+            return 0;
+    return 1;
+}
+
+float rr_renderer_measure_text(char const *text)
+{
+    if (!is_plain_text(text))
+        return rr_renderer_get_text_size(text);
+    if (!glyphs_measured)
+        measure_glyphs();
+    float width = 0;
+    for (; *text; ++text)
+    {
+        width += GLYPH_ADVANCES[(uint8_t)*text];
+        if (text[1])
+            width += glyph_kerning(text[0], text[1]);
+    }
+    return width;
+}
+
+// colors are part of the key at 5:6:5 bits, the glyph is drawn with the
+// quantized color so every hit looks the same
+static uint32_t quantize_color(uint32_t color, uint32_t *key)
+{
+    uint32_t red = color >> 19 & 31;
+    uint32_t green = color >> 10 & 63;
+    uint32_t blue = color >> 3 & 31;
+    *key = red << 11 | green << 5 | blue;
+    return 0xff000000 | (red << 3 | red >> 2) << 16 |
+           (green << 2 | green >> 4) << 8 | (blue << 3 | blue >> 2);
+}
+
+// every glyph sits at the width of the text before it, so kerning is kept
+static void draw_glyph_pass(struct rr_renderer *renderer, char const *text,
+                            uint32_t color, uint8_t stroke)
+{
+    uint32_t key;
+    struct glyph glyph = {quantize_color(color, &key), stroke, {0}};
+    uint32_t kind =
+        stroke ? rr_sprite_cache_kind_glyph_stroke : rr_sprite_cache_kind_glyph;
+    float pen = 0;
+    float at = 0;
+    for (; *text; ++text)
+    {
+        uint8_t c = *text;
+        float advance = GLYPH_ADVANCES[c] * GLYPH_SIZE;
+        if (c != ' ')
+        {
+            rr_renderer_translate(renderer, pen + advance / 2 - at, 0);
+            at = pen + advance / 2;
+            glyph.text[0] = c;
+            rr_renderer_draw_cached(renderer, kind << 24 | c << 16 | key,
+                                    advance + GLYPH_SIZE * 0.5f,
+                                    GLYPH_SIZE * 1.5f, draw_glyph, &glyph);
+        }
+        pen += advance;
+        if (text[1])
+            pen += glyph_kerning(c, text[1]) * GLYPH_SIZE;
+    }
+    rr_renderer_translate(renderer, -at, 0);
+}
+
+void rr_renderer_draw_stroked_text(struct rr_renderer *renderer,
+                                   char const *text, float x, float y,
+                                   float size, uint32_t fill, uint32_t stroke,
+                                   uint8_t align, uint8_t baseline)
+{
+    if (fill < 0xff000000 || stroke < 0xff000000 || !is_plain_text(text))
+    {
+        rr_renderer_set_fill(renderer, fill);
+        rr_renderer_set_stroke(renderer, stroke);
+        rr_renderer_set_text_size(renderer, size);
+        rr_renderer_set_line_width(renderer, size * 0.12);
+        rr_renderer_set_text_align(renderer, align);
+        rr_renderer_set_text_baseline(renderer, baseline);
+        rr_renderer_stroke_text(renderer, text, x, y);
+        rr_renderer_fill_text(renderer, text, x, y);
+        return;
+    }
+    float scale = size / GLYPH_SIZE;
+    float width = rr_renderer_measure_text(text) * GLYPH_SIZE;
+    // glyphs are centered on their advance and vertically on the em box
+    float pen = x / scale - width * align / 2;
+    float line = y / scale + GLYPH_SIZE / 2.0f * (1 - (int32_t)baseline);
+    rr_renderer_scale(renderer, scale);
+    rr_renderer_translate(renderer, pen, line);
+    draw_glyph_pass(renderer, text, stroke, 1);
+    draw_glyph_pass(renderer, text, fill, 0);
+    rr_renderer_translate(renderer, -pen, -line);
+    rr_renderer_scale(renderer, 1 / scale);
+}
+
+void rr_renderer_draw_text(struct rr_renderer *renderer, char const *text,
+                           float x, float y, float size, uint32_t fill,
+                           uint8_t align, uint8_t baseline)
+{
+    rr_renderer_draw_stroked_text(renderer, text, x, y, size, fill, 0xff222222,
+                                  align, baseline);
+}
+
+void rr_renderer_draw_damage_number(struct rr_renderer *renderer,
+                                    uint32_t damage, float x, float y)
+{
+    char out[11];
+    char *at = &out[10];
+    *at = 0;
+    do
+    {
+        *--at = '0' + damage % 10;
+        damage /= 10;
+    } while (damage != 0);
+    rr_renderer_draw_text(renderer, at, x, y, 36, 0xffff4444, 1, 1);
+}
+
 void rr_renderer_text_cache_init()
 {
+    // the web font may have loaded since the glyphs were last rasterized
+    measure_glyphs();
+    rr_renderer_sprite_cache_clear();
     if (!(text_cache.context_id))
         rr_renderer_init(&text_cache);
     rr_renderer_set_dimensions(
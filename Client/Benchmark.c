@@ -0,0 +1,226 @@
+// Copyright (C) 2024  Paul Johnson
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include <Client/Game.h>
+#include <Client/InputData.h>
+#include <Client/Renderer/Renderer.h>
+#include <Client/Simulation.h>
+#include <Client/Socket.h>
+
+// headless stand in for Main.c and Socket.c. replays a clientbound stream
+// recorded by a server started with RR_RECORD_PATH=<file> and times each
+// phase of rr_game_tick while drawing into an offscreen cairo surface
+//
+// usage: rrolf-client-bench <recording> [frames] [width] [height]
+
+#define SERVER_TICK_SECONDS (0.04f)
+#define FRAME_SECONDS (1.0f / 60)
+
+static char const *phase_names[rr_game_phase_max] = {
+    "interpolation", "entity render", "particles", "ui", "tape"};
+
+uint8_t RR_OUTGOING_PACKET[1024 * 16];
+
+// nothing is ever sent, the recording already has the server's side
+void rr_websocket_init(struct rr_websocket *this)
+{
+    memset(this, 0, sizeof *this);
+}
+void rr_websocket_connect_to(struct rr_websocket *this, char const *link) {}
+void rr_websocket_disconnect(struct rr_websocket *this, struct rr_game *game)
+{
+}
+void rr_websocket_send(struct rr_websocket *this, uint32_t length) {}
+void rr_websocket_queue_send(struct rr_websocket *this, uint32_t length) {}
+void rr_websocket_send_all(struct rr_websocket *this) {}
+
+struct phase_total
+{
+    double sum;
+    long max;
+};
+
+static void phase_add(struct phase_total *total, long time)
+{
+    total->sum += time;
+    if (time > total->max)
+        total->max = time;
+}
+
+static long elapsed(struct timeval *start)
+{
+    struct timeval end;
+    gettimeofday(&end, NULL);
+    return (end.tv_sec - start->tv_sec) * 1000000 +
+           (end.tv_usec - start->tv_usec);
+}
+
+static int compare_long(void const *a, void const *b)
+{
+    long x = *(long const *)a;
+    long y = *(long const *)b;
+    return (x > y) - (x < y);
+}
+
+static uint8_t *read_recording(char const *path, uint64_t *size)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+        return NULL;
+    fseek(file, 0, SEEK_END);
+    *size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t *data = malloc(*size);
+    if (fread(data, 1, *size, file) != *size)
+    {
+        free(data);
+        data = NULL;
+    }
+    fclose(file);
+    return data;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        fputs("usage: rrolf-client-bench <recording> [frames] [width] "
+              "[height]\n",
+              stderr);
+        return 1;
+    }
+    uint64_t size;
+    uint8_t *recording = read_recording(argv[1], &size);
+    if (recording == NULL || size < 8)
+    {
+        fprintf(stderr, "could not read recording %s\n", argv[1]);
+        return 1;
+    }
+    uint32_t frames = argc > 2 ? strtoul(argv[2], NULL, 10) : 3600;
+    float width = argc > 3 ? strtof(argv[3], NULL) : 1920;
+    float height = argc > 4 ? strtof(argv[4], NULL) : 1080;
+
+    static struct rr_game game;
+    static struct rr_renderer renderer;
+    static struct rr_input_data input_data;
+    // zeroed so that rr_simulation_init sees no component pages yet
+    struct rr_simulation *simulation = calloc(1, sizeof *simulation);
+    struct rr_simulation *deletion_simulation =
+        calloc(1, sizeof *deletion_simulation);
+
+    // the main renderer has to be the first context, like the page canvas
+    rr_renderer_init(&renderer);
+    rr_renderer_set_dimensions(&renderer, width, height);
+    rr_game_init(&game);
+    rr_input_data_init(&input_data);
+    rr_simulation_init(simulation);
+    rr_simulation_init(deletion_simulation);
+
+    game.renderer = &renderer;
+    game.input_data = &input_data;
+    game.simulation = simulation;
+    game.deletion_simulation = deletion_simulation;
+    float a = height / 1080;
+    float b = width / 1920;
+    renderer.scale = b < a ? a : b;
+    game.window->width = game.window->abs_width = width;
+    game.window->height = game.window->abs_height = height;
+    // first tick builds the asset caches, it isn't part of the measurement
+    rr_game_tick(&game, 1);
+
+    struct phase_total phases[rr_game_phase_max] = {0};
+    struct phase_total packet_total = {0};
+    struct phase_total frame_total = {0};
+    long *frame_times = malloc(frames * sizeof *frame_times);
+    uint64_t tape_instructions = 0;
+    uint64_t tape_bytes = 0;
+    uint32_t packets = 0;
+    uint64_t packet_bytes = 0;
+
+    uint8_t *at = recording;
+    uint8_t *end = recording + size;
+    uint32_t first_tick;
+    memcpy(&first_tick, at, sizeof first_tick);
+    float time = first_tick * SERVER_TICK_SECONDS;
+    uint32_t frame = 0;
+    for (; frame < frames && at < end; ++frame)
+    {
+        struct timeval start;
+        time += FRAME_SECONDS;
+        gettimeofday(&start, NULL);
+        while (at + 8 <= end)
+        {
+            uint32_t header[2];
+            memcpy(header, at, sizeof header);
+            if (header[0] * SERVER_TICK_SECONDS > time)
+                break;
+            if (at + 8 + header[1] > end)
+            {
+                at = end;
+                break;
+            }
+            rr_game_read_packet(&game, at + 8, header[1]);
+            packet_bytes += header[1];
+            at += 8 + header[1];
+            ++packets;
+        }
+        phase_add(&packet_total, elapsed(&start));
+
+        gettimeofday(&start, NULL);
+        rr_game_tick(&game, FRAME_SECONDS);
+        frame_times[frame] = elapsed(&start);
+        phase_add(&frame_total, frame_times[frame]);
+        for (uint32_t i = 0; i < rr_game_phase_max; ++i)
+            phase_add(&phases[i], game.debug_info.phase_times[i]);
+
+        struct rr_renderer_tape_stats tape_stats;
+        rr_renderer_get_tape_stats(&tape_stats);
+        tape_instructions += tape_stats.instructions;
+        tape_bytes += tape_stats.bytes;
+    }
+    if (frame == 0)
+    {
+        fputs("recording has no packets\n", stderr);
+        return 1;
+    }
+
+    qsort(frame_times, frame, sizeof *frame_times, compare_long);
+    printf("%u frames at %.0fx%.0f, %u packets\n", frame, width, height,
+           packets);
+    printf("%-16s%12s%12s\n", "phase", "mean us", "max us");
+    for (uint32_t i = 0; i < rr_game_phase_max; ++i)
+        printf("%-16s%12.1f%12ld\n", phase_names[i], phases[i].sum / frame,
+               phases[i].max);
+    printf("%-16s%12.1f%12ld\n", "packets", packet_total.sum / frame,
+           packet_total.max);
+    printf("%-16s%12.1f%12ld\n", "frame", frame_total.sum / frame,
+           frame_total.max);
+    if (packets)
+        printf("decode %.1f kb, %.2f us per packet, %.1f mb/s\n",
+               packet_bytes / 1024.0, packet_total.sum / packets,
+               packet_total.sum ? packet_bytes / packet_total.sum : 0.0);
+    printf("frame p50 %ld us, p95 %ld us, p99 %ld us\n",
+           frame_times[frame / 2], frame_times[frame * 95 / 100],
+           frame_times[frame * 99 / 100]);
+    printf("tape: %.0f ctx calls, %.1f kb per frame\n",
+           (double)tape_instructions / frame, tape_bytes / 1024.0 / frame);
+    return 0;
+}
@@ -15,10 +15,13 @@
 
 #include <Client/DOM.h>
 
+#ifdef EMSCRIPTEN
 #include <emscripten.h>
+#endif
 
 void rr_dom_create_text_element(char const *name, uint32_t text_limit)
 {
+#ifdef EMSCRIPTEN
     EM_ASM(
         {
             const name = UTF8ToString($0);
@@ -36,10 +39,12 @@ void rr_dom_create_text_element(char const *name, uint32_t text_limit)
             document.body.appendChild(elem);
         },
         name, text_limit);
+#endif
 }
 
 void rr_dom_element_show(char const *name)
 {
+#ifdef EMSCRIPTEN
     EM_ASM(
         {
             const name = UTF8ToString($0);
@@ -47,10 +52,12 @@ void rr_dom_element_show(char const *name)
             elem.style.display = 'block';
         },
         name);
+#endif
 }
 
 void rr_dom_element_hide(char const *name)
 {
+#ifdef EMSCRIPTEN
     EM_ASM(
         {
             const name = UTF8ToString($0);
@@ -59,11 +66,13 @@ void rr_dom_element_hide(char const *name)
             elem.style.width = elem.style.height = "0px";
         },
         name);
+#endif
 }
 
 void rr_dom_element_update_position(char const *name, float x, float y, float w,
                                     float h)
 {
+#ifdef EMSCRIPTEN
     EM_ASM(
         {
             const name = UTF8ToString($0);
@@ -75,10 +84,12 @@ void rr_dom_element_update_position(char const *name, float x, float y, float w,
             elem.style["font-size"] = $4 / devicePixelRatio * 0.8 + "px";
         },
         name, x, y, w, h);
+#endif
 }
 
 void rr_dom_retrieve_text(char const *name, char *out, uint32_t max_len)
 {
+#ifdef EMSCRIPTEN
     EM_ASM(
         {
             const name = UTF8ToString($0);
@@ -91,10 +102,12 @@ void rr_dom_retrieve_text(char const *name, char *out, uint32_t max_len)
             HEAPU8[$1 + len] = 0;
         },
         name, out, max_len);
+#endif
 }
 
 void rr_dom_set_text(char const *name, char *text)
 {
+#ifdef EMSCRIPTEN
     EM_ASM(
         {
             const name = UTF8ToString($0);
@@ -102,10 +115,12 @@ void rr_dom_set_text(char const *name, char *text)
             elem.value = UTF8ToString($1);
         },
         name, text);
+#endif
 }
 
 void rr_copy_string(char const *str)
 {
+#ifdef EMSCRIPTEN
     EM_ASM(
         {
             let elem = document.createElement("textarea");
@@ -135,22 +150,30 @@ void rr_copy_string(char const *str)
             document.body.removeChild(elem);
         },
         str);
+#endif
 }
 
 void rr_page_reload(uint8_t no_cache)
 {
+#ifdef EMSCRIPTEN
     EM_ASM({ location.reload($0); }, no_cache);
+#endif
 }
 
 uint8_t rr_dom_test_mobile()
 {
+#ifdef EMSCRIPTEN
     return EM_ASM_INT({
         return +((/iPhone|iPad|iPod|Android/i).test(navigator.userAgent));
     });
+#else
+    return 0;
+#endif
 }
 
 void rr_page_open(char const *name)
 {
+#ifdef EMSCRIPTEN
     EM_ASM(
         {
             try
@@ -162,4 +185,5 @@ void rr_page_open(char const *name)
             }
         },
         name);
-}
\ No newline at end of file
+#endif
+}
@@ -346,7 +346,7 @@ void rr_game_init(struct rr_game *this)
                         NULL
                     ),
                     rr_ui_level_bar_init(400),
-                    rr_ui_h_container_init(rr_ui_container_init(), 0, 15,
+                    rr_ui_cache_layer(rr_ui_h_container_init(rr_ui_container_init(), 0, 15,
                         rr_ui_title_screen_loadout_button_init(0),
                         rr_ui_title_screen_loadout_button_init(1),
                         rr_ui_title_screen_loadout_button_init(2),
@@ -358,8 +358,8 @@ void rr_game_init(struct rr_game *this)
                         rr_ui_title_screen_loadout_button_init(8),
                         rr_ui_title_screen_loadout_button_init(9),
                         NULL
-                    ),
-                    rr_ui_h_container_init(rr_ui_container_init(), 0, 15,
+                    )),
+                    rr_ui_cache_layer(rr_ui_h_container_init(rr_ui_container_init(), 0, 15,
                         rr_ui_title_screen_loadout_button_init(10),
                         rr_ui_title_screen_loadout_button_init(11),
                         rr_ui_title_screen_loadout_button_init(12),
@@ -371,7 +371,7 @@ void rr_game_init(struct rr_game *this)
                         rr_ui_title_screen_loadout_button_init(18),
                         rr_ui_title_screen_loadout_button_init(19),
                         NULL
-                    ),
+                    )),
                     rr_ui_text_init("powered by Rivet", 15, 0xffffffff),
                     NULL
                 ),
@@ -407,11 +407,12 @@ void rr_game_init(struct rr_game *this)
         -1, 1)
     );
 
+    // in-game loadout bar, both rows are drawn through one cache layer
     rr_ui_container_add_element(
         this->window,
         rr_ui_link_toggle(
             rr_ui_set_justify(
-                rr_ui_v_container_init(rr_ui_container_init(), 15, 15,
+                rr_ui_cache_layer(rr_ui_v_container_init(rr_ui_container_init(), 15, 15,
                     rr_ui_h_container_init(
                         rr_ui_container_init(), 0, 15,
                         rr_ui_text_init("[x]", 18, 0xffffffff),
@@ -443,17 +444,17 @@ void rr_game_init(struct rr_game *this)
                         NULL
                     ),
                     NULL
-                ),
+                )),
             0, 1),
         player_alive)
     );
 
-    rr_ui_container_add_element(this->window, rr_ui_container_add_element(rr_ui_inventory_container_init(), close_menu_button_init(25))->container);
-    rr_ui_container_add_element(this->window, rr_ui_container_add_element(rr_ui_mob_container_init(), close_menu_button_init(25))->container);
-    rr_ui_container_add_element(this->window, rr_ui_container_add_element(rr_ui_crafting_container_init(), close_menu_button_init(25))->container);
-    rr_ui_container_add_element(this->window, rr_ui_container_add_element(rr_ui_settings_container_init(this), close_menu_button_init(25))->container);
-    rr_ui_container_add_element(this->window, rr_ui_container_add_element(rr_ui_account_container_init(this), close_menu_button_init(25))->container);
-    rr_ui_container_add_element(this->window, rr_ui_container_add_element(rr_ui_dev_panel_container_init(this), close_menu_button_init(25))->container);
+    rr_ui_container_add_element(this->window, rr_ui_cache_layer(rr_ui_container_add_element(rr_ui_inventory_container_init(), close_menu_button_init(25))->container));
+    rr_ui_container_add_element(this->window, rr_ui_cache_layer(rr_ui_container_add_element(rr_ui_mob_container_init(), close_menu_button_init(25))->container));
+    rr_ui_container_add_element(this->window, rr_ui_cache_layer(rr_ui_container_add_element(rr_ui_crafting_container_init(), close_menu_button_init(25))->container));
+    rr_ui_container_add_element(this->window, rr_ui_cache_layer(rr_ui_container_add_element(rr_ui_settings_container_init(this), close_menu_button_init(25))->container));
+    rr_ui_container_add_element(this->window, rr_ui_cache_layer(rr_ui_container_add_element(rr_ui_account_container_init(this), close_menu_button_init(25))->container));
+    rr_ui_container_add_element(this->window, rr_ui_cache_layer(rr_ui_container_add_element(rr_ui_dev_panel_container_init(this), close_menu_button_init(25))->container));
 
     this->link_account_tooltip = rr_ui_container_add_element(
         this->window,
@@ -545,6 +546,219 @@ void rr_game_init(struct rr_game *this)
         RR_SLOT_COUNT_FROM_LEVEL(level_from_xp(this->cache.experience));
 }
 
+void rr_game_read_packet(struct rr_game *this, uint8_t *data, uint32_t size)
+{
+    struct proto_bug encoder;
+    proto_bug_init(&encoder, data);
+    proto_bug_set_bound(&encoder, data + size);
+    switch (proto_bug_read_uint8(&encoder, "header"))
+    {
+    case rr_clientbound_squad_update:
+    {
+        for (uint32_t i = 0; i < RR_SQUAD_MEMBER_COUNT; ++i)
+        {
+            this->squad.squad_members[i].in_use =
+                proto_bug_read_uint8(&encoder, "bitbit");
+            if (this->squad.squad_members[i].in_use == 0)
+                continue;
+            this->squad.squad_members[i].playing =
+                proto_bug_read_uint8(&encoder, "ready");
+            this->squad.squad_members[i].is_dev =
+                proto_bug_read_uint8(&encoder, "is_dev");
+            proto_bug_read_string(&encoder,
+                                  this->squad.squad_members[i].nickname, 16,
+                                  "nickname");
+            for (uint32_t j = 0; j < 20; ++j)
+            {
+                this->squad.squad_members[i].loadout[j].id =
+                    proto_bug_read_uint8(&encoder, "id");
+                this->squad.squad_members[i].loadout[j].rarity =
+                    proto_bug_read_uint8(&encoder, "rar");
+            }
+        }
+        this->squad.squad_pos = proto_bug_read_uint8(&encoder, "sqpos");
+        this->squad.squad_private =
+            proto_bug_read_uint8(&encoder, "private");
+        this->selected_biome = proto_bug_read_uint8(&encoder, "biome");
+        proto_bug_read_string(&encoder, this->squad.squad_code, 16,
+                              "squad code");
+        this->is_dev =
+            this->squad.squad_members[this->squad.squad_pos].is_dev;
+        break;
+    }
+    case rr_clientbound_update:
+    {
+        this->socket_error = 0;
+        this->joined_squad = 1;
+        proto_bug_read_varuint(&encoder, "squad version");
+        if (proto_bug_read_uint8(&encoder, "in game") == 1)
+        {
+            if (!this->simulation_ready)
+            {
+                rr_simulation_init(this->simulation);
+                rr_simulation_init(this->deletion_simulation);
+                this->simulation_ready = 1;
+            }
+            rr_simulation_read_binary(this, &encoder);
+        }
+        else
+        {
+            if (this->simulation_ready)
+                rr_simulation_init(this->simulation);
+            this->simulation_ready = 0;
+            proto_bug_init(&encoder, RR_OUTGOING_PACKET);
+            proto_bug_write_uint8(&encoder, rr_serverbound_squad_update,
+                                  "header");
+            proto_bug_write_string(&encoder, this->cache.nickname, 16,
+                                   "nickname");
+            proto_bug_write_uint8(&encoder, this->slots_unlocked,
+                                  "loadout count");
+            for (uint32_t i = 0; i < this->slots_unlocked; ++i)
+            {
+                proto_bug_write_uint8(&encoder, this->cache.loadout[i].id,
+                                      "id");
+                proto_bug_write_uint8(
+                    &encoder, this->cache.loadout[i].rarity, "rarity");
+                proto_bug_write_uint8(&encoder,
+                                      this->cache.loadout[i + 10].id, "id");
+                proto_bug_write_uint8(
+                    &encoder, this->cache.loadout[i + 10].rarity, "rarity");
+            }
+            rr_websocket_send(&this->socket,
+                              encoder.current - encoder.start);
+        }
+        break;
+    }
+    case rr_clientbound_squad_dump:
+    {
+        while (proto_bug_read_uint8(&encoder, "continue"))
+        {
+            uint8_t s = proto_bug_read_uint8(&encoder, "squad index");
+            if (s >= RR_SQUAD_COUNT)
+                break;
+            struct rr_game_squad *squad = &this->other_squads[s];
+            for (uint32_t i = 0; i < RR_SQUAD_MEMBER_COUNT; ++i)
+            {
+                squad->squad_members[i].in_use =
+                    proto_bug_read_uint8(&encoder, "bitbit");
+                if (squad->squad_members[i].in_use == 0)
+                    continue;
+                squad->squad_members[i].playing =
+                    proto_bug_read_uint8(&encoder, "ready");
+                squad->squad_members[i].is_dev =
+                    proto_bug_read_uint8(&encoder, "is_dev");
+                proto_bug_read_string(&encoder,
+                                      squad->squad_members[i].nickname, 16,
+                                      "nickname");
+                for (uint32_t j = 0; j < 20; ++j)
+                {
+                    squad->squad_members[i].loadout[j].id =
+                        proto_bug_read_uint8(&encoder, "id");
+                    squad->squad_members[i].loadout[j].rarity =
+                        proto_bug_read_uint8(&encoder, "rar");
+                }
+            }
+            squad->squad_private =
+                proto_bug_read_uint8(&encoder, "private");
+            this->selected_biome = proto_bug_read_uint8(&encoder, "biome");
+            proto_bug_read_string(&encoder, squad->squad_code, 16,
+                                  "squad code");
+        }
+        break;
+    }
+    case rr_clientbound_animation_update:
+    {
+        while (proto_bug_read_uint8(&encoder, "continue"))
+        {
+            struct rr_particle_manager *particles = &this->particle_manager;
+            switch (proto_bug_read_uint8(&encoder, "ani type"))
+            {
+            case rr_animation_type_lightningbolt:
+            {
+                struct rr_simulation_animation *bolt =
+                    rr_particle_alloc_lightning_bolt(particles);
+                bolt->length = proto_bug_read_uint8(&encoder, "ani length");
+                int32_t x = 0;
+                int32_t y = 0;
+                for (uint32_t i = 0; i < bolt->length; ++i)
+                {
+                    x += rr_zigzag_decode(
+                        proto_bug_read_varuint(&encoder, "ani x"));
+                    y += rr_zigzag_decode(
+                        proto_bug_read_varuint(&encoder, "ani y"));
+                    bolt->points[i].x = x;
+                    bolt->points[i].y = y;
+                }
+                bolt->opacity = 0.8;
+                break;
+            }
+            case rr_animation_type_damagenumber:
+            {
+                uint32_t i = rr_particle_alloc(
+                    particles, rr_animation_type_damagenumber);
+                particles->x[i] = proto_bug_read_varuint(&encoder, "ani x");
+                particles->y[i] = proto_bug_read_varuint(&encoder, "ani y");
+                particles->velocity_x[i] = (rr_frand() - 0.5) * 25;
+                particles->velocity_y[i] = -15 + rr_frand() * 5;
+                particles->acceleration_y[i] = 0.75;
+                particles->damage[i] =
+                    proto_bug_read_varuint(&encoder, "damage");
+                particles->opacity[i] = 1;
+                break;
+            }
+            case rr_animation_type_chat:
+                proto_bug_read_string(
+                    &encoder,
+                    this->chat.messages[this->chat.at].sender_name, 64,
+                    "name");
+                proto_bug_read_string(
+                    &encoder, this->chat.messages[this->chat.at].message,
+                    64, "chat");
+                this->chat.at = (this->chat.at + 1) % 10;
+                break;
+            default:
+                break;
+            }
+        }
+        break;
+    }
+    case rr_clientbound_squad_fail:
+        this->socket_error =
+            2 + proto_bug_read_uint8(&encoder, "fail type");
+        if (this->simulation_ready)
+            rr_simulation_init(this->simulation);
+        this->simulation_ready = 0;
+        this->joined_squad = 0;
+        break;
+    case rr_clientbound_squad_leave:
+        this->joined_squad = 0;
+        break;
+    case rr_clientbound_account_result:
+        read_account(&encoder, this);
+        break;
+    case rr_clientbound_craft_result:
+    {
+        uint8_t id = proto_bug_read_uint8(&encoder, "craft id");
+        uint8_t rarity = proto_bug_read_uint8(&encoder, "craft rarity");
+        uint32_t successes =
+            proto_bug_read_varuint(&encoder, "success count");
+        uint32_t fails = proto_bug_read_varuint(&encoder, "fail count");
+        uint32_t attempts = proto_bug_read_varuint(&encoder, "attempts");
+        this->cache.experience +=
+            proto_bug_read_float64(&encoder, "craft xp");
+        this->failed_crafts[id][rarity] = attempts;
+        this->inventory[id][rarity] -= fails;
+        this->crafting_data.count -= fails;
+        this->inventory[id][rarity + 1] += successes;
+        this->crafting_data.success_count = successes;
+        this->crafting_data.animation = 0;
+        break;
+    }
+    default:
+        RR_UNREACHABLE("how'd this happen");
+    }
+}
+
 void rr_game_websocket_on_event_function(enum rr_websocket_event_type type,
                                          void *data, void *captures,
                                          uint64_t size)
@@ -613,200 +827,7 @@ void rr_game_websocket_on_event_function(enum rr_websocket_event_type type,
         this->socket.clientbound_encryption_key =
             rr_get_hash(this->socket.clientbound_encryption_key);
         rr_decrypt(data, size, this->socket.clientbound_encryption_key);
-        uint8_t h = proto_bug_read_uint8(&encoder, "header");
-        switch (h)
-        {
-        case rr_clientbound_update:
-        {
-            this->socket_error = 0;
-            this->joined_squad = 1;
-
-            for (uint32_t i = 0; i < RR_SQUAD_MEMBER_COUNT; ++i)
-            {
-                this->squad.squad_members[i].in_use =
-                    proto_bug_read_uint8(&encoder, "bitbit");
-                if (this->squad.squad_members[i].in_use == 0)
-                    continue;
-                this->squad.squad_members[i].playing =
-                    proto_bug_read_uint8(&encoder, "ready");
-                this->squad.squad_members[i].is_dev =
-                    proto_bug_read_uint8(&encoder, "is_dev");
-                proto_bug_read_string(&encoder,
-                                      this->squad.squad_members[i].nickname, 16,
-                                      "nickname");
-                for (uint32_t j = 0; j < 20; ++j)
-                {
-                    this->squad.squad_members[i].loadout[j].id =
-                        proto_bug_read_uint8(&encoder, "id");
-                    this->squad.squad_members[i].loadout[j].rarity =
-                        proto_bug_read_uint8(&encoder, "rar");
-                }
-            }
-            this->squad.squad_pos = proto_bug_read_uint8(&encoder, "sqpos");
-            this->squad.squad_private =
-                proto_bug_read_uint8(&encoder, "private");
-            this->selected_biome = proto_bug_read_uint8(&encoder, "biome");
-            proto_bug_read_string(&encoder, this->squad.squad_code, 16,
-                                  "squad code");
-            this->is_dev =
-                this->squad.squad_members[this->squad.squad_pos].is_dev;
-            if (proto_bug_read_uint8(&encoder, "in game") == 1)
-            {
-                if (!this->simulation_ready)
-                {
-                    rr_simulation_init(this->simulation);
-                    rr_simulation_init(this->deletion_simulation);
-                    this->simulation_ready = 1;
-                }
-                rr_simulation_read_binary(this, &encoder);
-            }
-            else
-            {
-                if (this->simulation_ready)
-                    rr_simulation_init(this->simulation);
-                this->simulation_ready = 0;
-                proto_bug_init(&encoder, RR_OUTGOING_PACKET);
-                proto_bug_write_uint8(&encoder, rr_serverbound_squad_update,
-                                      "header");
-                proto_bug_write_string(&encoder, this->cache.nickname, 16,
-                                       "nickname");
-                proto_bug_write_uint8(&encoder, this->slots_unlocked,
-                                      "loadout count");
-                for (uint32_t i = 0; i < this->slots_unlocked; ++i)
-                {
-                    proto_bug_write_uint8(&encoder, this->cache.loadout[i].id,
-                                          "id");
-                    proto_bug_write_uint8(
-                        &encoder, this->cache.loadout[i].rarity, "rarity");
-                    proto_bug_write_uint8(&encoder,
-                                          this->cache.loadout[i + 10].id, "id");
-                    proto_bug_write_uint8(
-                        &encoder, this->cache.loadout[i + 10].rarity, "rarity");
-                }
-                rr_websocket_send(&this->socket,
-                                  encoder.current - encoder.start);
-            }
-            break;
-        }
-        case rr_clientbound_squad_dump:
-        {
-            for (uint32_t s = 0; s < RR_SQUAD_COUNT; ++s)
-            {
-                struct rr_game_squad *squad = &this->other_squads[s];
-                for (uint32_t i = 0; i < RR_SQUAD_MEMBER_COUNT; ++i)
-                {
-                    squad->squad_members[i].in_use =
-                        proto_bug_read_uint8(&encoder, "bitbit");
-                    if (squad->squad_members[i].in_use == 0)
-                        continue;
-                    squad->squad_members[i].playing =
-                        proto_bug_read_uint8(&encoder, "ready");
-                    squad->squad_members[i].is_dev =
-                        proto_bug_read_uint8(&encoder, "is_dev");
-                    proto_bug_read_string(&encoder,
-                                          squad->squad_members[i].nickname, 16,
-                                          "nickname");
-                    for (uint32_t j = 0; j < 20; ++j)
-                    {
-                        squad->squad_members[i].loadout[j].id =
-                            proto_bug_read_uint8(&encoder, "id");
-                        squad->squad_members[i].loadout[j].rarity =
-                            proto_bug_read_uint8(&encoder, "rar");
-                    }
-                }
-                squad->squad_private =
-                    proto_bug_read_uint8(&encoder, "private");
-                this->selected_biome = proto_bug_read_uint8(&encoder, "biome");
-                proto_bug_read_string(&encoder, squad->squad_code, 16,
-                                      "squad code");
-            }
-            break;
-        }
-        case rr_clientbound_animation_update:
-        {
-            while (proto_bug_read_uint8(&encoder, "continue"))
-            {
-                struct rr_simulation_animation *particle = rr_particle_alloc(
-                    &this->particle_manager,
-                    proto_bug_read_uint8(&encoder, "ani type"));
-                switch (particle->type)
-                {
-                case rr_animation_type_lightningbolt:
-                    particle->length =
-                        proto_bug_read_uint8(&encoder, "ani length");
-                    for (uint32_t i = 0; i < particle->length; ++i)
-                    {
-                        particle->points[i].x =
-                            proto_bug_read_float32(&encoder, "ani x");
-                        particle->points[i].y =
-                            proto_bug_read_float32(&encoder, "ani y");
-                    }
-                    particle->opacity = 0.8;
-                    break;
-                case rr_animation_type_damagenumber:
-                {
-                    particle->x = proto_bug_read_float32(&encoder, "ani x");
-                    particle->y = proto_bug_read_float32(&encoder, "ani y");
-                    particle->velocity.x = (rr_frand() - 0.5) * 25;
-                    particle->velocity.y = -15 + rr_frand() * 5;
-                    particle->acceleration.y = 0.75;
-                    particle->damage =
-                        proto_bug_read_varuint(&encoder, "damage");
-                    particle->opacity = 1;
-                    break;
-                }
-                case rr_animation_type_chat:
-                    rr_particle_delete(&this->particle_manager, particle);
-                    proto_bug_read_string(
-                        &encoder,
-                        this->chat.messages[this->chat.at].sender_name, 64,
-                        "name");
-                    proto_bug_read_string(
-                        &encoder, this->chat.messages[this->chat.at].message,
-                        64, "chat");
-                    this->chat.at = (this->chat.at + 1) % 10;
-                    break;
-                default:
-                    break;
-                }
-            }
-            break;
-        }
-        case rr_clientbound_squad_fail:
-            this->socket_error =
-                2 + proto_bug_read_uint8(&encoder, "fail type");
-            if (this->simulation_ready)
-                rr_simulation_init(this->simulation);
-            this->simulation_ready = 0;
-            this->joined_squad = 0;
-            break;
-        case rr_clientbound_squad_leave:
-            this->joined_squad = 0;
-            break;
-        case rr_clientbound_account_result:
-            read_account(&encoder, this);
-            break;
-        case rr_clientbound_craft_result:
-        {
-            uint8_t id = proto_bug_read_uint8(&encoder, "craft id");
-            uint8_t rarity = proto_bug_read_uint8(&encoder, "craft rarity");
-            uint32_t successes =
-                proto_bug_read_varuint(&encoder, "success count");
-            uint32_t fails = proto_bug_read_varuint(&encoder, "fail count");
-            uint32_t attempts = proto_bug_read_varuint(&encoder, "attempts");
-            this->cache.experience +=
-                proto_bug_read_float64(&encoder, "craft xp");
-            this->failed_crafts[id][rarity] = attempts;
-            this->inventory[id][rarity] -= fails;
-            this->crafting_data.count -= fails;
-            this->inventory[id][rarity + 1] += successes;
-            this->crafting_data.success_count = successes;
-            this->crafting_data.animation = 0;
-            break;
-        }
-        default:
-            RR_UNREACHABLE("how'd this happen");
-        }
+        rr_game_read_packet(this, data, size);
         break;
     }
     default:
@@ -814,79 +835,6 @@ void rr_game_websocket_on_event_function(enum rr_websocket_event_type type,
     }
 }
 
-void render_drop_component(EntityIdx entity, struct rr_game *this,
-                           struct rr_simulation *simulation)
-{
-    struct rr_renderer_context_state state;
-    rr_renderer_context_state_init(this->renderer, &state);
-    struct rr_component_physical *physical =
-        rr_simulation_get_physical(simulation, entity);
-    rr_renderer_translate(this->renderer, physical->lerp_x, physical->lerp_y);
-    rr_component_drop_render(entity, this, simulation);
-    rr_renderer_context_state_free(this->renderer, &state);
-}
-
-void render_health_component(EntityIdx entity, struct rr_game *this,
-                             struct rr_simulation *simulation)
-{
-    struct rr_renderer_context_state state;
-    rr_renderer_context_state_init(this->renderer, &state);
-    struct rr_component_physical *physical =
-        rr_simulation_get_physical(simulation, entity);
-    rr_renderer_translate(this->renderer, physical->lerp_x,
-                          physical->lerp_y + physical->radius + 30);
-    rr_component_health_render(entity, this, simulation);
-    rr_renderer_context_state_free(this->renderer, &state);
-}
-
-void render_mob_component(EntityIdx entity, struct rr_game *this,
-                          struct rr_simulation *simulation)
-{
-    struct rr_renderer_context_state state;
-    rr_renderer_context_state_init(this->renderer, &state);
-    struct rr_component_physical *physical =
-        rr_simulation_get_physical(simulation, entity);
-    rr_renderer_translate(this->renderer, physical->lerp_x, physical->lerp_y);
-    rr_component_mob_render(entity, this, simulation);
-    rr_renderer_context_state_free(this->renderer, &state);
-}
-
-void render_petal_component(EntityIdx entity, struct rr_game *this,
-                            struct rr_simulation *simulation)
-{
-    struct rr_renderer_context_state state;
-    rr_renderer_context_state_init(this->renderer, &state);
-    struct rr_component_physical *physical =
-        rr_simulation_get_physical(simulation, entity);
-    rr_renderer_translate(this->renderer, physical->lerp_x, physical->lerp_y);
-    rr_component_petal_render(entity, this, simulation);
-    rr_renderer_context_state_free(this->renderer, &state);
-}
-
-void render_flower_component(EntityIdx entity, struct rr_game *this,
-                             struct rr_simulation *simulation)
-{
-    struct rr_renderer_context_state state;
-    rr_renderer_context_state_init(this->renderer, &state);
-    struct rr_component_physical *physical =
-        rr_simulation_get_physical(simulation, entity);
-    rr_renderer_translate(this->renderer, physical->lerp_x, physical->lerp_y);
-    rr_component_flower_render(entity, this, simulation);
-    rr_renderer_context_state_free(this->renderer, &state);
-}
-
-void render_web_component(EntityIdx entity, struct rr_game *this,
-                          struct rr_simulation *simulation)
-{
-    struct rr_renderer_context_state state;
-    rr_renderer_context_state_init(this->renderer, &state);
-    struct rr_component_physical *physical =
-        rr_simulation_get_physical(simulation, entity);
-    rr_renderer_translate(this->renderer, physical->lerp_x, physical->lerp_y);
-    rr_component_web_render(entity, this, simulation);
-    rr_renderer_context_state_free(this->renderer, &state);
-}
-
 void player_info_finder(struct rr_game *this)
 {
     struct rr_simulation *simulation = this->simulation;
@@ -957,6 +905,17 @@ static void write_serverbound_packet_desktop(struct rr_game *this)
     }
 }
 
+// microseconds since the mark, which is moved up to now
+static long phase_elapsed(struct timeval *mark)
+{
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    long elapsed =
+        (now.tv_sec - mark->tv_sec) * 1000000 + (now.tv_usec - mark->tv_usec);
+    *mark = now;
+    return elapsed;
+}
+
 void rr_game_tick(struct rr_game *this, float delta)
 {
     if (this->ticks_until_text_cache == 0)
@@ -970,6 +929,10 @@ void rr_game_tick(struct rr_game *this, float delta)
     struct timeval start;
     struct timeval end;
 
+    struct timeval phase_mark;
+    long *phase_times = this->debug_info.phase_times;
+    memset(phase_times, 0, sizeof this->debug_info.phase_times);
+
     gettimeofday(&start, NULL);
     this->slots_unlocked =
         RR_SLOT_COUNT_FROM_LEVEL(level_from_xp(this->cache.experience));
@@ -985,9 +948,11 @@ void rr_game_tick(struct rr_game *this, float delta)
 
     if (this->simulation_ready)
     {
+        gettimeofday(&phase_mark, NULL);
         rr_simulation_tick(this->simulation, this->lerp_delta);
         rr_deletion_simulation_tick(this->deletion_simulation,
                                     this->lerp_delta);
+        phase_times[rr_game_phase_interpolation] += phase_elapsed(&phase_mark);
 
         this->renderer->state.filter.amount = 0;
         struct rr_renderer_context_state state1;
@@ -1019,25 +984,28 @@ void rr_game_tick(struct rr_game *this, float delta)
             rr_component_arena_render(player_info->arena, this,
                                       this->simulation);
 
-#define render_component(COMPONENT)                                            \
-    for (uint32_t i = 0; i < this->simulation->COMPONENT##_count; ++i)         \
-        render_##COMPONENT##_component(                                        \
-            this->simulation->COMPONENT##_vector[i], this, this->simulation);  \
-    for (uint32_t i = 0; i < this->deletion_simulation->COMPONENT##_count;     \
-         ++i)                                                                  \
-        render_##COMPONENT##_component(                                        \
-            this->deletion_simulation->COMPONENT##_vector[i], this,            \
-            this->deletion_simulation);
-
-            render_component(web);
-            render_component(health);
-            render_component(drop);
-            render_component(mob);
+            float view_scale =
+                player_info->lerp_camera_fov * this->renderer->scale;
+            rr_render_queue_set_view(
+                &this->render_queue, player_info->lerp_camera_x,
+                player_info->lerp_camera_y,
+                this->renderer->width / 2 / view_scale,
+                this->renderer->height / 2 / view_scale);
+            rr_render_queue_submit_simulation(&this->render_queue,
+                                              this->simulation);
+            rr_render_queue_submit_simulation(&this->render_queue,
+                                              this->deletion_simulation);
+            rr_render_queue_flush(&this->render_queue, this,
+                                  rr_render_layer_mob);
+            phase_times[rr_game_phase_entity_render] +=
+                phase_elapsed(&phase_mark);
             rr_system_particle_render_tick(this, delta);
-            render_component(petal);
-            render_component(flower);
+            phase_times[rr_game_phase_particles] += phase_elapsed(&phase_mark);
+            rr_render_queue_flush(&this->render_queue, this,
+                                  rr_render_layer_flower);
+            phase_times[rr_game_phase_entity_render] +=
+                phase_elapsed(&phase_mark);
             rr_renderer_context_state_free(this->renderer, &state1);
-#undef render_component
         }
     }
     else
@@ -1149,6 +1117,7 @@ void rr_game_tick(struct rr_game *this, float delta)
         rr_renderer_context_state_free(this->renderer, &state1);
     }
     // ui
+    gettimeofday(&phase_mark, NULL);
     this->crafting_data.animation -= delta;
     if (this->crafting_data.animation < 0)
         this->crafting_data.animation = 0;
@@ -1168,8 +1137,11 @@ void rr_game_tick(struct rr_game *this, float delta)
             this->prev_focused->on_event(this->prev_focused, this);
     }
     this->block_ui_input = 0;
+    phase_times[rr_game_phase_ui] += phase_elapsed(&phase_mark);
 #ifndef EMSCRIPTEN
-    lws_service(this->socket.socket_context, -1);
+    // the headless benchmark never opens a socket
+    if (this->socket.socket_context != NULL)
+        lws_service(this->socket.socket_context, -1);
 #endif
     if (this->socket_ready)
     {
@@ -1189,11 +1161,6 @@ void rr_game_tick(struct rr_game *this, float delta)
     {
         struct rr_renderer_context_state state;
         rr_renderer_context_state_init(this->renderer, &state);
-        rr_renderer_set_text_size(this->renderer, 12);
-        rr_renderer_set_line_width(this->renderer, 12 * 0.12);
-        rr_renderer_set_text_baseline(this->renderer, 2);
-        rr_renderer_set_fill(this->renderer, 0xffffffff);
-        rr_renderer_set_text_align(this->renderer, 2);
         rr_renderer_translate(this->renderer, this->renderer->width,
                               this->renderer->height);
         rr_renderer_scale(this->renderer, this->renderer->scale);
@@ -1220,16 +1187,39 @@ void rr_game_tick(struct rr_game *this, float delta)
             "tick time (avg/max): %.1f/%.1f | frame time (avg/max): %.1f/%.1f",
             tick_sum * 0.001f / RR_DEBUG_POLL_SIZE, tick_max * 0.001f,
             frame_sum * 0.001f / RR_DEBUG_POLL_SIZE, frame_max * 0.001f);
-        rr_renderer_stroke_text(this->renderer, debug_mspt, 0, 0);
-        rr_renderer_fill_text(this->renderer, debug_mspt, 0, 0);
-        sprintf(debug_mspt, "ctx calls: %d", rr_renderer_get_op_size());
+        rr_renderer_draw_text(this->renderer, debug_mspt, 0, 0, 12, 0xffffffff,
+                              2, 2);
+        struct rr_renderer_tape_stats tape_stats;
+        rr_renderer_get_tape_stats(&tape_stats);
+        sprintf(debug_mspt, "ctx calls: %u | tape: %.1f kb | replay: %.2f ms",
+                tape_stats.instructions, tape_stats.bytes / 1024.0f,
+                tape_stats.execute_time);
+        rr_renderer_translate(this->renderer, 0, -14);
+        rr_renderer_draw_text(this->renderer, debug_mspt, 0, 0, 12, 0xffffffff,
+                              2, 2);
+        struct rr_renderer_sprite_cache_stats sprite_stats;
+        rr_renderer_get_sprite_cache_stats(&sprite_stats);
+        sprintf(debug_mspt, "atlas: %u hit %u miss %u evict | %.1f mb",
+                sprite_stats.hits, sprite_stats.misses, sprite_stats.evictions,
+                sprite_stats.bytes / (1024.0f * 1024.0f));
+        rr_renderer_translate(this->renderer, 0, -14);
+        rr_renderer_draw_text(this->renderer, debug_mspt, 0, 0, 12, 0xffffffff,
+                              2, 2);
+        sprintf(debug_mspt, "entities: %u drawn %u culled",
+                this->render_queue.drawn, this->render_queue.culled);
+        rr_renderer_translate(this->renderer, 0, -14);
+        rr_renderer_draw_text(this->renderer, debug_mspt, 0, 0, 12, 0xffffffff,
+                              2, 2);
         rr_renderer_context_state_free(this->renderer, &state);
         // rr_renderer_stroke_text
     }
     rr_renderer_context_state_free(this->renderer, &grand_state);
 
+    gettimeofday(&phase_mark, NULL);
     rr_renderer_execute_instructions();
+    phase_times[rr_game_phase_tape] += phase_elapsed(&phase_mark);
     rr_renderer_reset_instruction_queue();
+    rr_renderer_sprite_cache_end_frame();
 
     if (this->socket_ready)
         rr_websocket_send_all(&this->socket);
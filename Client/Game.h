@@ -16,6 +16,7 @@
 #pragma once
 
 #include <Client/Particle.h>
+#include <Client/Renderer/RenderQueue.h>
 #include <Client/Renderer/Renderer.h>
 #include <Client/Socket.h>
 #include <Client/Ui/Ui.h>
@@ -38,6 +39,17 @@ enum rr_game_menu
     rr_game_menu_dev_squad_panel
 };
 
+// parts of rr_game_tick that get timed separately
+enum rr_game_phase
+{
+    rr_game_phase_interpolation,
+    rr_game_phase_entity_render,
+    rr_game_phase_particles,
+    rr_game_phase_ui,
+    rr_game_phase_tape,
+    rr_game_phase_max
+};
+
 struct rr_game_debug_info
 {
     uint8_t frame_pos;
@@ -45,6 +57,8 @@ struct rr_game_debug_info
     long tick_times[RR_DEBUG_POLL_SIZE];
     long frame_times[RR_DEBUG_POLL_SIZE];
     long message_sizes[RR_DEBUG_POLL_SIZE];
+    // microseconds spent in each phase during the last tick
+    long phase_times[rr_game_phase_max];
 };
 
 struct rr_game_crafting_data
@@ -102,6 +116,7 @@ struct rr_developer_cheats
 struct rr_game
 {
     struct rr_particle_manager particle_manager;
+    struct rr_render_queue render_queue;
     struct rr_game_crafting_data crafting_data;
     struct rr_game_debug_info debug_info;
     struct rr_game_chat chat;
@@ -170,6 +185,8 @@ void rr_simulation_read_binary(struct rr_game *, struct proto_bug *);
 
 void rr_game_websocket_on_event_function(enum rr_websocket_event_type, void *,
                                          void *, uint64_t);
+// handles one decrypted clientbound packet
+void rr_game_read_packet(struct rr_game *, uint8_t *, uint32_t);
 
 uint32_t rr_game_get_adjusted_inventory_count(struct rr_game *, uint8_t,
                                               uint8_t);
@@ -297,9 +297,10 @@ int main()
     static struct rr_game game;
     static struct rr_renderer renderer;
     static struct rr_input_data input_data;
-    struct rr_simulation *simulation = malloc(sizeof *simulation);
+    // zeroed so that rr_simulation_init sees no component pages yet
+    struct rr_simulation *simulation = calloc(1, sizeof *simulation);
     struct rr_simulation *deletion_simulation =
-        malloc(sizeof *deletion_simulation);
+        calloc(1, sizeof *deletion_simulation);
     rr_main_loop(&game);
 
     rr_renderer_init(&renderer);
@@ -15,68 +15,210 @@
 
 #include <Client/Particle.h>
 
-#include <stdio.h>
 #include <string.h>
 
+#include <Client/Assets/RenderFunctions.h>
 #include <Client/Renderer/Renderer.h>
 
 #include <Shared/StaticData.h>
 
+#define ALPHA_BUCKETS 16
+#define MAX_BATCH_COLORS 8
+
+static uint16_t batch_order[RR_PARTICLE_CAPACITY];
+static uint16_t batch_start[MAX_BATCH_COLORS * ALPHA_BUCKETS + 1];
+
+uint32_t rr_particle_alloc(struct rr_particle_manager *this, uint8_t type)
+{
+    // when full the newest particle is recycled, it's rarely noticeable
+    uint32_t i = this->count;
+    if (i == RR_PARTICLE_CAPACITY)
+        i = RR_PARTICLE_CAPACITY - 1;
+    else
+        ++this->count;
+    this->x[i] = this->y[i] = 0;
+    this->velocity_x[i] = this->velocity_y[i] = this->acceleration_y[i] = 0;
+    this->size[i] = this->opacity[i] = 0;
+    this->color[i] = this->damage[i] = 0;
+    this->type[i] = type;
+    return i;
+}
+
 struct rr_simulation_animation *
-rr_particle_alloc(struct rr_particle_manager *this, uint8_t type)
+rr_particle_alloc_lightning_bolt(struct rr_particle_manager *this)
 {
-    struct rr_simulation_animation *ret = &this->particles[this->size];
+    uint32_t i = this->lightning_bolt_count;
+    if (i == RR_LIGHTNING_BOLT_CAPACITY)
+        i = RR_LIGHTNING_BOLT_CAPACITY - 1;
+    else
+        ++this->lightning_bolt_count;
+    struct rr_simulation_animation *ret = &this->lightning_bolts[i];
     memset(ret, 0, sizeof *ret);
-    ret->type = type;
-    ++this->size;
+    ret->type = rr_animation_type_lightningbolt;
     return ret;
 }
 
-void rr_particle_delete(struct rr_particle_manager *this,
-                        struct rr_simulation_animation *particle)
+void rr_particle_manager_update(struct rr_particle_manager *this)
 {
-    if (&this->particles[this->size - 1] != particle)
-        memcpy(particle, &this->particles[this->size - 1],
-               sizeof(struct rr_simulation_animation));
-    --this->size;
+    uint32_t count = this->count;
+    float *restrict x = this->x;
+    float *restrict y = this->y;
+    float *restrict velocity_x = this->velocity_x;
+    float *restrict velocity_y = this->velocity_y;
+    float const *restrict acceleration_y = this->acceleration_y;
+    float *restrict opacity = this->opacity;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        velocity_x[i] *= 0.9f;
+        velocity_y[i] = velocity_y[i] * 0.9f + acceleration_y[i];
+        x[i] += velocity_x[i];
+        y[i] += velocity_y[i];
+        opacity[i] *= 0.9f;
+    }
+
+    // stable compaction keeps the draw order of the survivors
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (opacity[i] < 0.01f)
+            continue;
+        if (kept != i)
+        {
+            x[kept] = x[i];
+            y[kept] = y[i];
+            velocity_x[kept] = velocity_x[i];
+            velocity_y[kept] = velocity_y[i];
+            this->acceleration_y[kept] = acceleration_y[i];
+            this->size[kept] = this->size[i];
+            opacity[kept] = opacity[i];
+            this->color[kept] = this->color[i];
+            this->damage[kept] = this->damage[i];
+            this->type[kept] = this->type[i];
+        }
+        ++kept;
+    }
+    this->count = kept;
+
+    kept = 0;
+    for (uint32_t i = 0; i < this->lightning_bolt_count; ++i)
+    {
+        struct rr_simulation_animation *bolt = &this->lightning_bolts[i];
+        bolt->opacity *= 0.9f;
+        if (bolt->opacity < 0.01f)
+            continue;
+        if (kept != i)
+            this->lightning_bolts[kept] = *bolt;
+        ++kept;
+    }
+    this->lightning_bolt_count = kept;
 }
 
-void rr_renderer_render_particle(struct rr_renderer *renderer,
-                                 struct rr_simulation_animation *this)
+static void render_circle_batches(struct rr_renderer *renderer,
+                                  struct rr_particle_manager *this)
 {
-    rr_renderer_set_global_alpha(renderer, this->opacity);
-    switch (this->type)
+    // circles are bucketed by (color, quantized opacity) with a counting
+    // sort, then every bucket is a single path and a single fill
+    uint32_t colors[MAX_BATCH_COLORS];
+    uint32_t color_count = 0;
+    uint16_t counts[MAX_BATCH_COLORS * ALPHA_BUCKETS] = {0};
+    uint32_t batched = 0;
+    for (uint32_t i = 0; i < this->count; ++i)
+    {
+        if (this->type[i] != rr_animation_type_default)
+            continue;
+        uint32_t slot = 0;
+        while (slot < color_count && colors[slot] != this->color[i])
+            ++slot;
+        if (slot == MAX_BATCH_COLORS)
+        {
+            // more distinct colors than slots, draw this one on its own
+            rr_renderer_set_global_alpha(renderer, this->opacity[i]);
+            rr_renderer_set_fill(renderer, this->color[i]);
+            rr_renderer_begin_path(renderer);
+            rr_renderer_arc(renderer, this->x[i], this->y[i], this->size[i]);
+            rr_renderer_fill(renderer);
+            continue;
+        }
+        if (slot == color_count)
+            colors[color_count++] = this->color[i];
+        uint32_t alpha = this->opacity[i] * ALPHA_BUCKETS;
+        if (alpha >= ALPHA_BUCKETS)
+            alpha = ALPHA_BUCKETS - 1;
+        ++counts[slot * ALPHA_BUCKETS + alpha];
+        ++batched;
+    }
+    if (batched == 0)
+        return;
+
+    uint32_t buckets = color_count * ALPHA_BUCKETS;
+    batch_start[0] = 0;
+    for (uint32_t b = 0; b < buckets; ++b)
+        batch_start[b + 1] = batch_start[b] + counts[b];
+    for (uint32_t i = 0; i < this->count; ++i)
     {
-    case rr_animation_type_default:
-        rr_renderer_set_fill(renderer, this->color);
+        if (this->type[i] != rr_animation_type_default)
+            continue;
+        uint32_t slot = 0;
+        while (slot < color_count && colors[slot] != this->color[i])
+            ++slot;
+        if (slot == color_count)
+            continue;
+        uint32_t alpha = this->opacity[i] * ALPHA_BUCKETS;
+        if (alpha >= ALPHA_BUCKETS)
+            alpha = ALPHA_BUCKETS - 1;
+        // counts doubles as the write cursor of each bucket
+        uint32_t b = slot * ALPHA_BUCKETS + alpha;
+        batch_order[batch_start[b + 1] - counts[b]--] = i;
+    }
+
+    for (uint32_t b = 0; b < buckets; ++b)
+    {
+        if (batch_start[b] == batch_start[b + 1])
+            continue;
+        rr_renderer_set_global_alpha(
+            renderer, ((b % ALPHA_BUCKETS) + 0.5f) / ALPHA_BUCKETS);
+        rr_renderer_set_fill(renderer, colors[b / ALPHA_BUCKETS]);
         rr_renderer_begin_path(renderer);
-        rr_renderer_arc(renderer, this->x, this->y, this->size);
+        for (uint32_t j = batch_start[b]; j < batch_start[b + 1]; ++j)
+        {
+            uint32_t i = batch_order[j];
+            rr_renderer_move_to(renderer, this->x[i] + this->size[i],
+                                this->y[i]);
+            rr_renderer_arc(renderer, this->x[i], this->y[i], this->size[i]);
+        }
         rr_renderer_fill(renderer);
-        break;
-    case rr_animation_type_lightningbolt:
+    }
+}
+
+void rr_renderer_render_particles(struct rr_renderer *renderer,
+                                  struct rr_particle_manager *this)
+{
+    render_circle_batches(renderer, this);
+
+    if (this->lightning_bolt_count != 0)
+    {
         rr_renderer_set_stroke(renderer, 0xffccccfc);
         rr_renderer_set_line_width(renderer, 4);
+    }
+    for (uint32_t i = 0; i < this->lightning_bolt_count; ++i)
+    {
+        struct rr_simulation_animation *bolt = &this->lightning_bolts[i];
+        rr_renderer_set_global_alpha(renderer, bolt->opacity);
         rr_renderer_begin_path(renderer);
-        rr_renderer_move_to(renderer, this->points[0].x, this->points[0].y);
-        for (uint32_t i = 1; i < this->length; ++i)
-            rr_renderer_line_to(renderer, this->points[i].x, this->points[i].y);
+        rr_renderer_move_to(renderer, bolt->points[0].x, bolt->points[0].y);
+        for (uint32_t j = 1; j < bolt->length; ++j)
+            rr_renderer_line_to(renderer, bolt->points[j].x,
+                                bolt->points[j].y);
         rr_renderer_stroke(renderer);
-        break;
-    case rr_animation_type_damagenumber:
-        rr_renderer_set_fill(renderer, 0xffff4444);
-        rr_renderer_set_stroke(renderer, 0xff222222);
-        rr_renderer_set_text_size(renderer, 36);
-        rr_renderer_set_line_width(renderer, 36 * 0.12);
-        rr_renderer_set_text_align(renderer, 1);
-        rr_renderer_set_text_baseline(renderer, 1);
-        rr_renderer_begin_path(renderer);
-        char a[16];
-        sprintf(a, "%d", this->damage);
-        rr_renderer_stroke_text(renderer, a, this->x, this->y);
-        rr_renderer_fill_text(renderer, a, this->x, this->y);
-        break;
-    default:
-        break;
+    }
+
+    for (uint32_t i = 0; i < this->count; ++i)
+    {
+        if (this->type[i] != rr_animation_type_damagenumber)
+            continue;
+        rr_renderer_set_global_alpha(renderer, this->opacity[i]);
+        rr_renderer_draw_damage_number(renderer, this->damage[i], this->x[i],
+                                       this->y[i]);
     }
     rr_renderer_set_global_alpha(renderer, 1);
-}
\ No newline at end of file
+}
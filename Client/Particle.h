@@ -23,15 +23,32 @@
 
 struct rr_renderer;
 
+#define RR_PARTICLE_CAPACITY 16384
+#define RR_LIGHTNING_BOLT_CAPACITY 256
+
+// default particles and damage numbers are stored column wise so the per
+// frame update is a few straight loops the compiler can vectorize. bolts
+// carry 16 points each and only fade, so they get their own small array
 struct rr_particle_manager
 {
-    struct rr_simulation_animation particles[16384];
-    uint32_t size;
+    float x[RR_PARTICLE_CAPACITY];
+    float y[RR_PARTICLE_CAPACITY];
+    float velocity_x[RR_PARTICLE_CAPACITY];
+    float velocity_y[RR_PARTICLE_CAPACITY];
+    float acceleration_y[RR_PARTICLE_CAPACITY];
+    float size[RR_PARTICLE_CAPACITY];
+    float opacity[RR_PARTICLE_CAPACITY];
+    uint32_t color[RR_PARTICLE_CAPACITY];
+    uint32_t damage[RR_PARTICLE_CAPACITY];
+    uint8_t type[RR_PARTICLE_CAPACITY];
+    uint32_t count;
+    struct rr_simulation_animation lightning_bolts[RR_LIGHTNING_BOLT_CAPACITY];
+    uint32_t lightning_bolt_count;
 };
 
-struct rr_simulation_animation *rr_particle_alloc(struct rr_particle_manager *,
-                                                  uint8_t);
-void rr_particle_delete(struct rr_particle_manager *,
-                        struct rr_simulation_animation *);
-void rr_renderer_render_particle(struct rr_renderer *,
-                                 struct rr_simulation_animation *);
\ No newline at end of file
+uint32_t rr_particle_alloc(struct rr_particle_manager *, uint8_t);
+struct rr_simulation_animation *
+rr_particle_alloc_lightning_bolt(struct rr_particle_manager *);
+void rr_particle_manager_update(struct rr_particle_manager *);
+void rr_renderer_render_particles(struct rr_renderer *,
+                                  struct rr_particle_manager *);
@@ -15,236 +15,746 @@
 
 #include <Client/Renderer/Renderer.h>
 
+#include <cairo/cairo.h>
 #include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
+
+// records the exact same tape as the wasm renderer and replays it into cairo
+// image surfaces instead of canvases, so the native client (and the headless
+// benchmark) measure the same instruction stream the browser executes. the
+// only difference is that text lives in its own buffer since pointers don't
+// fit in a tape word here
 extern "C"
 {
+    union tape_word
+    {
+        float f;
+        uint32_t u;
+    };
+
+    // the canvas state that cairo doesn't track itself
+    struct native_paint
+    {
+        uint32_t fill;
+        uint32_t stroke;
+        float global_alpha;
+        float text_size;
+        uint8_t text_align;
+        uint8_t text_baseline;
+    };
+
+#define NATIVE_SAVE_DEPTH 64
+
+    struct native_context
+    {
+        cairo_surface_t *surface;
+        cairo_t *cairo;
+        struct native_paint paint;
+        struct native_paint saved[NATIVE_SAVE_DEPTH];
+        uint32_t depth;
+    };
+
+    static struct native_context *contexts = NULL;
+    static uint32_t context_count = 0;
+    static uint32_t context_capacity = 0;
+
+    static union tape_word *instruction_tape = NULL;
+    static uint32_t tape_size = 0;
+    static uint32_t tape_capacity = 0;
+    static uint32_t instruction_size = 0;
+    static char *text_buffer = NULL;
+    static uint32_t text_size = 0;
+    static uint32_t text_capacity = 0;
+    static struct rr_renderer_tape_stats frame_stats = {0};
+    static struct rr_renderer_tape_stats last_frame_stats = {0};
+
+    static union tape_word *tape_push(struct rr_renderer *self, uint8_t op,
+                                      uint32_t words)
+    {
+        if (tape_size + words + 1 > tape_capacity)
+        {
+            uint32_t capacity = tape_capacity == 0 ? INSTRUCTION_QUEUE_MAX_SIZE
+                                                   : tape_capacity * 2;
+            union tape_word *tape = (union tape_word *)realloc(
+                instruction_tape, capacity * sizeof *instruction_tape);
+            // same as the wasm renderer, a half recorded frame can't be
+            // flushed so running out of memory here is fatal
+            if (tape == NULL)
+            {
+                fputs("renderer: out of memory growing the instruction tape\n",
+                      stderr);
+                abort();
+            }
+            instruction_tape = tape;
+            tape_capacity = capacity;
+        }
+        union tape_word *record = &instruction_tape[tape_size];
+        record[0].u = op | (uint32_t)self->context_id << 8 | words << 24;
+        tape_size += words + 1;
+        ++instruction_size;
+        return record + 1;
+    }
+
+    static void update_if_transformed(struct rr_renderer *self)
+    {
+        if (self->matrix_moddified)
+        {
+            self->matrix_moddified = 0;
+            union tape_word *args = tape_push(self, 9, 6);
+            for (uint32_t i = 0; i < 6; ++i)
+                args[i].f = self->state.transform_matrix[i];
+            args[2].f -= self->origin_x;
+            args[5].f -= self->origin_y;
+        }
+    }
+
+    static void reset_context(struct native_context *context, float w, float h)
+    {
+        if (context->cairo != NULL)
+        {
+            cairo_destroy(context->cairo);
+            cairo_surface_destroy(context->surface);
+        }
+        context->surface = cairo_image_surface_create(
+            CAIRO_FORMAT_ARGB32, w < 1 ? 1 : w, h < 1 ? 1 : h);
+        context->cairo = cairo_create(context->surface);
+        // canvas defaults
+        cairo_set_line_width(context->cairo, 1);
+        cairo_select_font_face(context->cairo, "Ubuntu",
+                               CAIRO_FONT_SLANT_NORMAL,
+                               CAIRO_FONT_WEIGHT_NORMAL);
+        context->paint.fill = 0xff000000;
+        context->paint.stroke = 0xff000000;
+        context->paint.global_alpha = 1;
+        context->paint.text_size = 10;
+        context->paint.text_align = 0;
+        context->paint.text_baseline = 2;
+        context->depth = 0;
+    }
+
     void rr_renderer_init(struct rr_renderer *self)
     {
         memset(self, 0, sizeof(*self));
         self->state.transform_matrix[0] = 1;
         self->state.transform_matrix[4] = 1;
-        self->surface = cairo_image_surface_create(
-            CAIRO_FORMAT_ARGB32, 500,
-            500); // default size, should be resized later
-        self->context = cairo_create(self->surface);
+        if (context_count == context_capacity)
+        {
+            context_capacity = context_capacity == 0 ? 64 : context_capacity * 2;
+            contexts = (struct native_context *)realloc(
+                contexts, context_capacity * sizeof *contexts);
+        }
+        self->context_id = context_count++;
+        memset(&contexts[self->context_id], 0, sizeof *contexts);
+        reset_context(&contexts[self->context_id], 1, 1);
     }
 
     void rr_renderer_set_dimensions(struct rr_renderer *self, float w, float h)
     {
         self->width = w;
         self->height = h;
-        cairo_surface_destroy(self->surface);
-        self->surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, w, h);
-        cairo_destroy(self->context);
-        self->context = cairo_create(self->surface);
+        // like resizing a canvas this is immediate and clears everything
+        reset_context(&contexts[self->context_id], w, h);
     }
 
-    void rr_renderer_set_fill(struct rr_renderer *self, uint32_t c)
+    static uint32_t apply_filter(struct rr_renderer *self, uint32_t c)
     {
-        // Convert the uint32_t color into RGBA
-        double r = ((c >> 16) & 0xFF) / 255.0;
-        double g = ((c >> 8) & 0xFF) / 255.0;
-        double b = (c & 0xFF) / 255.0;
-        double a = ((c >> 24) & 0xFF) / 255.0;
+        float a = self->state.filter.amount;
+        uint32_t fc = self->state.filter.color;
+        uint32_t out = c & 0xff000000;
+        for (uint32_t shift = 0; shift < 24; shift += 8)
+        {
+            float channel =
+                ((c >> shift) & 255) * (1 - a) + ((fc >> shift) & 255) * a;
+            channel = channel < 0 ? 0 : channel > 255 ? 255 : channel;
+            out |= (uint32_t)channel << shift;
+        }
+        return out;
+    }
 
-        cairo_set_source_rgba(self->context, r, g, b, a);
+    void rr_renderer_set_fill(struct rr_renderer *self, uint32_t c)
+    {
+        tape_push(self, 0, 1)[0].u = apply_filter(self, c);
     }
 
     void rr_renderer_set_stroke(struct rr_renderer *self, uint32_t c)
     {
-        // Convert the uint32_t color into RGBA
-        double r = ((c >> 16) & 0xFF) / 255.0;
-        double g = ((c >> 8) & 0xFF) / 255.0;
-        double b = (c & 0xFF) / 255.0;
-        double a = ((c >> 24) & 0xFF) / 255.0;
-
-        cairo_set_source_rgba(self->context, r, g, b, a);
+        tape_push(self, 1, 1)[0].u = apply_filter(self, c);
     }
 
     void rr_renderer_set_line_width(struct rr_renderer *self, float w)
     {
-        cairo_set_line_width(self->context, w);
+        tape_push(self, 2, 1)[0].f = w;
+    }
+
+    void rr_renderer_set_text_size(struct rr_renderer *self, float s)
+    {
+        tape_push(self, 3, 1)[0].f = s;
     }
 
     void rr_renderer_set_global_alpha(struct rr_renderer *self, float a)
     {
-        // Not applicable in cairo
-        // test
+        tape_push(self, 4, 1)[0].f = a;
+        self->state.global_alpha = a;
     }
 
     void rr_renderer_set_line_cap(struct rr_renderer *self, uint8_t l)
     {
-        cairo_line_cap_t cap;
-        switch (l)
-        {
-        case 0:
-            cap = CAIRO_LINE_CAP_BUTT;
-            break;
-        case 1:
-            cap = CAIRO_LINE_CAP_ROUND;
-            break;
-        case 2:
-            cap = CAIRO_LINE_CAP_SQUARE;
-            break;
-        }
-        cairo_set_line_cap(self->context, cap);
+        tape_push(self, 5, 1)[0].u = l;
     }
 
     void rr_renderer_set_line_join(struct rr_renderer *self, uint8_t l)
     {
-        cairo_line_join_t join;
-        switch (l)
-        {
-        case 0:
-            join = CAIRO_LINE_JOIN_BEVEL;
-            break;
-        case 1:
-            join = CAIRO_LINE_JOIN_ROUND;
-            break;
-        case 2:
-            join = CAIRO_LINE_JOIN_MITER;
-            break;
-        }
-        cairo_set_line_join(self->context, join);
+        tape_push(self, 6, 1)[0].u = l;
     }
 
-    void rr_renderer_update_transform(struct rr_renderer *self)
+    void rr_renderer_set_text_align(struct rr_renderer *self, uint8_t l)
     {
-        cairo_matrix_t matrix;
-        cairo_matrix_init(
-            &matrix, self->state.transform_matrix[0],
-            self->state.transform_matrix[1], self->state.transform_matrix[3],
-            self->state.transform_matrix[4], self->state.transform_matrix[2],
-            self->state.transform_matrix[5]);
-        cairo_set_matrix(self->context, &matrix);
+        tape_push(self, 7, 1)[0].u = l;
     }
 
-    void rr_renderer_save(struct rr_renderer *self)
+    void rr_renderer_set_text_baseline(struct rr_renderer *self, uint8_t l)
     {
-        cairo_save(self->context);
+        tape_push(self, 8, 1)[0].u = l;
     }
 
+    void rr_renderer_update_transform(struct rr_renderer *self)
+    {
+        self->matrix_moddified = 1;
+    }
+
+    void rr_renderer_save(struct rr_renderer *self) { tape_push(self, 10, 0); }
+
     void rr_renderer_restore(struct rr_renderer *self)
     {
-        cairo_restore(self->context);
+        self->matrix_moddified = 1;
+        tape_push(self, 11, 0);
     }
 
     void rr_renderer_begin_path(struct rr_renderer *self)
     {
-        cairo_new_path(self->context);
+        update_if_transformed(self);
+        tape_push(self, 12, 0);
     }
 
     void rr_renderer_move_to(struct rr_renderer *self, float x, float y)
     {
-        cairo_move_to(self->context, x, y);
+        update_if_transformed(self);
+        union tape_word *args = tape_push(self, 13, 2);
+        args[0].f = x;
+        args[1].f = y;
     }
 
     void rr_renderer_line_to(struct rr_renderer *self, float x, float y)
     {
-        cairo_line_to(self->context, x, y);
+        update_if_transformed(self);
+        union tape_word *args = tape_push(self, 14, 2);
+        args[0].f = x;
+        args[1].f = y;
     }
 
     void rr_renderer_quadratic_curve_to(struct rr_renderer *self, float x1,
                                         float y1, float x, float y)
     {
-        double x0, y0;
-        cairo_get_current_point(self->context, &x0, &y0);
-        cairo_curve_to(self->context, x0 + 2. / 3 * (x1 - x0),
-                       y0 + 2. / 3 * (y1 - y0), x1, y1, x, y);
+        update_if_transformed(self);
+        union tape_word *args = tape_push(self, 15, 4);
+        args[0].f = x1;
+        args[1].f = y1;
+        args[2].f = x;
+        args[3].f = y;
     }
 
     void rr_renderer_bezier_curve_to(struct rr_renderer *self, float x1,
                                      float y1, float x2, float y2, float x,
                                      float y)
     {
-        cairo_curve_to(self->context, x1, y1, x2, y2, x, y);
+        update_if_transformed(self);
+        union tape_word *args = tape_push(self, 16, 6);
+        args[0].f = x1;
+        args[1].f = y1;
+        args[2].f = x2;
+        args[3].f = y2;
+        args[4].f = x;
+        args[5].f = y;
     }
 
     void rr_renderer_partial_arc(struct rr_renderer *self, float x, float y,
                                  float r, float sa, float ea, uint8_t ccw)
     {
-        if (ccw)
-            cairo_arc_negative(self->context, x, y, r, sa, ea);
-        else
-            cairo_arc(self->context, x, y, r, sa, ea);
+        update_if_transformed(self);
+        union tape_word *args = tape_push(self, 17, 6);
+        args[0].f = x;
+        args[1].f = y;
+        args[2].f = r;
+        args[3].f = sa;
+        args[4].f = ea;
+        args[5].u = ccw;
     }
 
     void rr_renderer_ellipse(struct rr_renderer *self, float x, float y,
                              float rx, float ry)
     {
-        cairo_save(self->context);
-        cairo_translate(self->context, x, y);
-        cairo_scale(self->context, rx, ry);
-        cairo_arc(self->context, 0., 0., 1., 0., 2 * M_PI);
-        cairo_restore(self->context);
+        update_if_transformed(self);
+        union tape_word *args = tape_push(self, 18, 4);
+        args[0].f = x;
+        args[1].f = y;
+        args[2].f = rx;
+        args[3].f = ry;
     }
 
     void rr_renderer_rect(struct rr_renderer *self, float x, float y, float w,
                           float h)
     {
-        cairo_rectangle(self->context, x, y, w, h);
+        update_if_transformed(self);
+        union tape_word *args = tape_push(self, 19, 4);
+        args[0].f = x;
+        args[1].f = y;
+        args[2].f = w;
+        args[3].f = h;
+    }
+
+    void rr_renderer_draw_clipped_image(struct rr_renderer *self,
+                                        struct rr_renderer *image, float sx,
+                                        float sy, float sw, float sh,
+                                        float dx, float dy)
+    {
+        update_if_transformed(self);
+        union tape_word *args = tape_push(self, 20, 7);
+        args[0].u = image->context_id;
+        args[1].f = sx - sw / 2;
+        args[2].f = sy - sh / 2;
+        args[3].f = sw;
+        args[4].f = sh;
+        args[5].f = dx - sw / 2;
+        args[6].f = dy - sh / 2;
+    }
+
+    void rr_renderer_draw_translated_image(struct rr_renderer *self,
+                                           struct rr_renderer *image, float x,
+                                           float y)
+    {
+        rr_renderer_draw_clipped_image(self, image, image->width / 2,
+                                       image->height / 2, image->width,
+                                       image->height, x, y);
+    }
+
+    void rr_renderer_draw_image(struct rr_renderer *self,
+                                struct rr_renderer *image)
+    {
+        rr_renderer_draw_translated_image(self, image, 0, 0);
+    }
+
+    // svgs need a browser to decode, they are skipped natively
+    void rr_renderer_draw_svg(struct rr_renderer *self, char *svg, float x,
+                              float y)
+    {
     }
 
     void rr_renderer_fill_rect(struct rr_renderer *self, float x, float y,
                                float w, float h)
     {
-        cairo_rectangle(self->context, x, y, w, h);
-        cairo_fill(self->context);
+        update_if_transformed(self);
+        union tape_word *args = tape_push(self, 21, 4);
+        args[0].f = x;
+        args[1].f = y;
+        args[2].f = w;
+        args[3].f = h;
     }
 
     void rr_renderer_stroke_rect(struct rr_renderer *self, float x, float y,
                                  float w, float h)
     {
-        cairo_rectangle(self->context, x, y, w, h);
-        cairo_stroke(self->context);
+        update_if_transformed(self);
+        union tape_word *args = tape_push(self, 22, 4);
+        args[0].f = x;
+        args[1].f = y;
+        args[2].f = w;
+        args[3].f = h;
     }
 
     void rr_renderer_fill(struct rr_renderer *self)
     {
-        cairo_fill(self->context);
+        update_if_transformed(self);
+        tape_push(self, 23, 0);
     }
 
     void rr_renderer_stroke(struct rr_renderer *self)
     {
-        cairo_stroke(self->context);
+        update_if_transformed(self);
+        tape_push(self, 24, 0);
     }
 
     void rr_renderer_clip(struct rr_renderer *self)
     {
-        cairo_clip(self->context);
+        update_if_transformed(self);
+        tape_push(self, 25, 0);
     }
 
     void rr_renderer_clip2(struct rr_renderer *self)
     {
-        cairo_fill_rule_t fill_rule = CAIRO_FILL_RULE_EVEN_ODD;
-        cairo_set_fill_rule(self->context, fill_rule);
-        cairo_clip(self->context);
+        update_if_transformed(self);
+        tape_push(self, 26, 0);
     }
 
-    void rr_renderer_draw_image(struct rr_renderer *self, struct rr_renderer *b)
+    static void push_text(struct rr_renderer *self, uint8_t op, char const *c,
+                          float x, float y)
     {
+        update_if_transformed(self);
+        uint32_t len = strlen(c) + 1;
+        if (text_size + len > text_capacity)
+        {
+            while (text_size + len > text_capacity)
+                text_capacity = text_capacity == 0 ? 4096 : text_capacity * 2;
+            char *buffer = (char *)realloc(text_buffer, text_capacity);
+            if (buffer == NULL)
+            {
+                fputs("renderer: out of memory growing the text buffer\n",
+                      stderr);
+                abort();
+            }
+            text_buffer = buffer;
+        }
+        memcpy(text_buffer + text_size, c, len);
+        union tape_word *args = tape_push(self, op, 3);
+        args[0].f = x;
+        args[1].f = y;
+        args[2].u = text_size;
+        text_size += len;
     }
-    void rr_renderer_fill_text(struct rr_renderer *self, char const *a, float b,
-                               float c)
+
+    void rr_renderer_fill_text(struct rr_renderer *self, char const *c,
+                               float x, float y)
     {
+        push_text(self, 27, c, x, y);
     }
-    void rr_renderer_stroke_text(struct rr_renderer *self, char const *a,
-                                 float b, float c)
+
+    void rr_renderer_stroke_text(struct rr_renderer *self, char const *c,
+                                 float x, float y)
     {
+        push_text(self, 28, c, x, y);
     }
-    void rr_renderer_set_text_align(struct rr_renderer *self, uint8_t a) {}
-    void rr_renderer_set_text_baseline(struct rr_renderer *self, uint8_t a) {}
-    void rr_renderer_set_text_size(struct rr_renderer *self, float a) {}
-    void rr_renderer_draw_svg(struct rr_renderer *self, char *svg, float x,
-                              float y)
+
+    float rr_renderer_get_text_size(char const *c)
     {
+        static cairo_surface_t *surface = NULL;
+        static cairo_t *measure = NULL;
+        if (measure == NULL)
+        {
+            surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32, 1, 1);
+            measure = cairo_create(surface);
+            cairo_select_font_face(measure, "Ubuntu", CAIRO_FONT_SLANT_NORMAL,
+                                   CAIRO_FONT_WEIGHT_NORMAL);
+            cairo_set_font_size(measure, 1);
+        }
+        cairo_text_extents_t extents;
+        cairo_text_extents(measure, c, &extents);
+        return extents.x_advance;
     }
-    float rr_renderer_get_text_size(char const *a) { return 0; }
 
-    void rr_renderer_draw_translated_image(struct rr_renderer *self,
-                                           struct rr_renderer *other, float x,
-                                           float y)
+    static void set_source(struct native_context *context, uint32_t c)
+    {
+        cairo_set_source_rgba(context->cairo, ((c >> 16) & 255) / 255.0,
+                              ((c >> 8) & 255) / 255.0, (c & 255) / 255.0,
+                              (c >> 24) / 255.0 * context->paint.global_alpha);
+    }
+
+    // canvas fill_rect, draw_image and text leave the current path alone
+    // while cairo builds them out of it
+    static cairo_path_t *detach_path(cairo_t *cairo)
+    {
+        cairo_path_t *path = cairo_copy_path(cairo);
+        cairo_new_path(cairo);
+        return path;
+    }
+
+    static void reattach_path(cairo_t *cairo, cairo_path_t *path)
+    {
+        cairo_new_path(cairo);
+        cairo_append_path(cairo, path);
+        cairo_path_destroy(path);
+    }
+
+    static void arc(cairo_t *cairo, float x, float y, float r, float sa,
+                    float ea, uint32_t ccw)
+    {
+        // a canvas sweep of 2pi or more is a full circle, cairo would wrap
+        // the end angle around and draw nothing
+        if (fabsf(ea - sa) >= 2 * M_PI)
+            ea = ccw ? sa - 2 * M_PI : sa + 2 * M_PI;
+        if (ccw)
+            cairo_arc_negative(cairo, x, y, r, sa, ea);
+        else
+            cairo_arc(cairo, x, y, r, sa, ea);
+    }
+
+    static void text(struct native_context *context, char const *string,
+                     float x, float y, uint8_t stroke)
+    {
+        cairo_t *cairo = context->cairo;
+        cairo_text_extents_t text_extents;
+        cairo_font_extents_t font_extents;
+        cairo_set_font_size(cairo, context->paint.text_size);
+        cairo_text_extents(cairo, string, &text_extents);
+        cairo_font_extents(cairo, &font_extents);
+        x -= text_extents.x_advance * context->paint.text_align * 0.5f;
+        if (context->paint.text_baseline == 0)
+            y += font_extents.ascent;
+        else if (context->paint.text_baseline == 1)
+            y += (font_extents.ascent - font_extents.descent) * 0.5f;
+        else
+            y -= font_extents.descent;
+        cairo_path_t *path = detach_path(cairo);
+        cairo_move_to(cairo, x, y);
+        cairo_text_path(cairo, string);
+        set_source(context,
+                   stroke ? context->paint.stroke : context->paint.fill);
+        if (stroke)
+            cairo_stroke(cairo);
+        else
+            cairo_fill(cairo);
+        reattach_path(cairo, path);
+    }
+
+    static void execute(union tape_word *at, union tape_word *end)
+    {
+        static cairo_line_cap_t const caps[] = {CAIRO_LINE_CAP_BUTT,
+                                                CAIRO_LINE_CAP_ROUND,
+                                                CAIRO_LINE_CAP_SQUARE};
+        static cairo_line_join_t const joins[] = {CAIRO_LINE_JOIN_BEVEL,
+                                                  CAIRO_LINE_JOIN_ROUND,
+                                                  CAIRO_LINE_JOIN_MITER};
+        while (at < end)
+        {
+            uint32_t header = at->u;
+            struct native_context *context =
+                &contexts[(header >> 8) & 65535];
+            cairo_t *cairo = context->cairo;
+            union tape_word *a = at + 1;
+            at = a + (header >> 24);
+            switch (header & 255)
+            {
+            case 0:
+                context->paint.fill = a[0].u;
+                break;
+            case 1:
+                context->paint.stroke = a[0].u;
+                break;
+            case 2:
+                cairo_set_line_width(cairo, a[0].f);
+                break;
+            case 3:
+                context->paint.text_size = a[0].f;
+                break;
+            case 4:
+                context->paint.global_alpha = a[0].f;
+                break;
+            case 5:
+                cairo_set_line_cap(cairo, caps[a[0].u % 3]);
+                break;
+            case 6:
+                cairo_set_line_join(cairo, joins[a[0].u % 3]);
+                break;
+            case 7:
+                context->paint.text_align = a[0].u;
+                break;
+            case 8:
+                context->paint.text_baseline = a[0].u;
+                break;
+            case 9:
+            {
+                cairo_matrix_t matrix;
+                cairo_matrix_init(&matrix, a[0].f, a[1].f, a[3].f, a[4].f,
+                                  a[2].f, a[5].f);
+                cairo_set_matrix(cairo, &matrix);
+                break;
+            }
+            case 10:
+                if (context->depth < NATIVE_SAVE_DEPTH)
+                    context->saved[context->depth] = context->paint;
+                ++context->depth;
+                cairo_save(cairo);
+                break;
+            case 11:
+                if (context->depth == 0)
+                    break;
+                if (--context->depth < NATIVE_SAVE_DEPTH)
+                    context->paint = context->saved[context->depth];
+                cairo_restore(cairo);
+                break;
+            case 12:
+                cairo_new_path(cairo);
+                break;
+            case 13:
+                cairo_move_to(cairo, a[0].f, a[1].f);
+                break;
+            case 14:
+                cairo_line_to(cairo, a[0].f, a[1].f);
+                break;
+            case 15:
+            {
+                double x0 = a[0].f;
+                double y0 = a[1].f;
+                if (cairo_has_current_point(cairo))
+                    cairo_get_current_point(cairo, &x0, &y0);
+                else
+                    cairo_move_to(cairo, x0, y0);
+                cairo_curve_to(cairo, x0 + 2. / 3 * (a[0].f - x0),
+                               y0 + 2. / 3 * (a[1].f - y0),
+                               a[2].f + 2. / 3 * (a[0].f - a[2].f),
+                               a[3].f + 2. / 3 * (a[1].f - a[3].f), a[2].f,
+                               a[3].f);
+                break;
+            }
+            case 16:
+                cairo_curve_to(cairo, a[0].f, a[1].f, a[2].f, a[3].f, a[4].f,
+                               a[5].f);
+                break;
+            case 17:
+                arc(cairo, a[0].f, a[1].f, a[2].f, a[3].f, a[4].f, a[5].u);
+                break;
+            case 18:
+            {
+                cairo_matrix_t matrix;
+                cairo_get_matrix(cairo, &matrix);
+                cairo_translate(cairo, a[0].f, a[1].f);
+                cairo_scale(cairo, a[2].f, a[3].f);
+                cairo_arc(cairo, 0, 0, 1, 0, 2 * M_PI);
+                cairo_set_matrix(cairo, &matrix);
+                break;
+            }
+            case 19:
+                cairo_rectangle(cairo, a[0].f, a[1].f, a[2].f, a[3].f);
+                break;
+            case 20:
+            {
+                cairo_path_t *path = detach_path(cairo);
+                cairo_save(cairo);
+                cairo_rectangle(cairo, a[5].f, a[6].f, a[3].f, a[4].f);
+                cairo_clip(cairo);
+                cairo_set_source_surface(cairo, contexts[a[0].u].surface,
+                                         a[5].f - a[1].f, a[6].f - a[2].f);
+                cairo_paint_with_alpha(cairo, context->paint.global_alpha);
+                cairo_restore(cairo);
+                reattach_path(cairo, path);
+                break;
+            }
+            case 21:
+            case 22:
+            {
+                cairo_path_t *path = detach_path(cairo);
+                cairo_rectangle(cairo, a[0].f, a[1].f, a[2].f, a[3].f);
+                if ((header & 255) == 21)
+                {
+                    set_source(context, context->paint.fill);
+                    cairo_fill(cairo);
+                }
+                else
+                {
+                    set_source(context, context->paint.stroke);
+                    cairo_stroke(cairo);
+                }
+                reattach_path(cairo, path);
+                break;
+            }
+            case 23:
+                set_source(context, context->paint.fill);
+                cairo_fill_preserve(cairo);
+                break;
+            case 24:
+                set_source(context, context->paint.stroke);
+                cairo_stroke_preserve(cairo);
+                break;
+            case 25:
+                cairo_clip_preserve(cairo);
+                break;
+            case 26:
+                cairo_set_fill_rule(cairo, CAIRO_FILL_RULE_EVEN_ODD);
+                cairo_clip_preserve(cairo);
+                cairo_set_fill_rule(cairo, CAIRO_FILL_RULE_WINDING);
+                break;
+            case 27:
+            case 28:
+                text(context, text_buffer + a[2].u, a[0].f, a[1].f,
+                     (header & 255) == 28);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    void rr_renderer_execute_instructions()
+    {
+        struct timespec start;
+        struct timespec end;
+        frame_stats.instructions += instruction_size;
+        frame_stats.bytes += tape_size * sizeof *instruction_tape;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        execute(instruction_tape, instruction_tape + tape_size);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        frame_stats.execute_time += (end.tv_sec - start.tv_sec) * 1000.0 +
+                                    (end.tv_nsec - start.tv_nsec) / 1000000.0;
+        tape_size = 0;
+        text_size = 0;
+        instruction_size = 0;
+    }
+
+    uint32_t rr_renderer_get_op_size()
+    {
+        return frame_stats.instructions + instruction_size;
+    }
+
+    void rr_renderer_get_tape_stats(struct rr_renderer_tape_stats *stats)
+    {
+        *stats = last_frame_stats;
+    }
+
+    uint32_t rr_renderer_tape_mark() { return tape_size; }
+
+    uint64_t rr_renderer_tape_hash(uint32_t mark, uint32_t context_id)
+    {
+        // fnv-1a over the records, text by content rather than by offset
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (uint32_t at = mark; at < tape_size;)
+        {
+            uint32_t header = instruction_tape[at].u;
+            uint32_t op = header & 255;
+            uint32_t words = header >> 24;
+            if ((header >> 8 & 0xffff) != context_id)
+                return 0;
+            uint32_t hashed = op == 27 || op == 28 ? 3 : words + 1;
+            for (uint32_t i = 0; i < hashed; ++i)
+                hash = (hash ^ instruction_tape[at + i].u) * 0x100000001b3ull;
+            if (op == 27 || op == 28)
+                for (char const *c = text_buffer + instruction_tape[at + 3].u;
+                     *c; ++c)
+                    hash = (hash ^ (uint8_t)*c) * 0x100000001b3ull;
+            at += words + 1;
+        }
+        return hash == 0 ? 1 : hash;
+    }
+
+    void rr_renderer_tape_rewind(uint32_t mark)
+    {
+        for (uint32_t at = mark; at < tape_size;)
+        {
+            uint32_t header = instruction_tape[at].u;
+            // text is appended in tape order, so the first string after the
+            // mark is where the text buffer ended
+            if (((header & 255) == 27 || (header & 255) == 28) &&
+                instruction_tape[at + 3].u < text_size)
+                text_size = instruction_tape[at + 3].u;
+            at += (header >> 24) + 1;
+            --instruction_size;
+        }
+        tape_size = mark;
+    }
+
+    void rr_renderer_reset_instruction_queue()
     {
+        last_frame_stats = frame_stats;
+        memset(&frame_stats, 0, sizeof frame_stats);
     }
 }
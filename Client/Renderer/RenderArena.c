@@ -16,6 +16,8 @@
 #include <Client/Renderer/ComponentRender.h>
 
 #include <math.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include <Client/Assets/Render.h>
 #include <Client/Assets/RenderFunctions.h>
@@ -23,7 +25,146 @@
 #include <Client/InputData.h>
 #include <Client/Renderer/Renderer.h>
 #include <Client/Simulation.h>
-#include <Shared/Crypto.h>
+
+// the maze background is rasterized into square chunks of CHUNK_PIXELS the
+// first time they come into view. the raster scale follows the on screen
+// scale in powers of two, so a chunk covers CHUNK_PIXELS / raster units of
+// the world and stays sharp at any zoom or pixel ratio. the pool holds what
+// the view needs plus a ring around it, entries past that give their
+// backing store back since contexts are never freed
+#define TILE_SIZE (256.0f)
+#define CHUNK_PIXELS (512)
+#define MIN_RASTER (0.25f)
+#define MAX_RASTER (4.0f)
+
+struct background_chunk
+{
+    struct rr_renderer renderer;
+    uint32_t last_used;
+    int32_t x;
+    int32_t y;
+    float raster;
+    uint8_t biome;
+    uint8_t initialized : 1;
+    uint8_t valid : 1;
+};
+
+static struct background_chunk *chunk_cache = NULL;
+static uint32_t chunk_capacity = 0;
+static uint32_t chunk_count = 0;
+static uint32_t background_frame = 0;
+
+static uint8_t maze_tile_at(uint8_t biome, int32_t tile_x, int32_t tile_y)
+{
+    float grid_size = RR_MAZES[biome].grid_size;
+    int32_t maze_dim = RR_MAZES[biome].maze_dim;
+    int32_t nx = floorf(tile_x * TILE_SIZE / grid_size);
+    int32_t ny = floorf(tile_y * TILE_SIZE / grid_size);
+    if (nx < 0 || ny < 0 || nx >= maze_dim || ny >= maze_dim)
+        return 0;
+    return RR_MAZES[biome].maze[ny * maze_dim + nx].value;
+}
+
+static void draw_maze_tile(struct rr_renderer *renderer, uint8_t tile)
+{
+    if (tile == 2)
+        rr_water_draw(renderer);
+    else if (tile == 0)
+        rr_dirt_draw(renderer);
+    else
+        rr_grass_draw(renderer);
+}
+
+static void render_chunk(struct background_chunk *chunk)
+{
+    struct rr_renderer *renderer = &chunk->renderer;
+    struct rr_renderer_context_state state;
+    float raster = chunk->raster;
+    float size = CHUNK_PIXELS / raster;
+    float left = chunk->x * size;
+    float top = chunk->y * size;
+    // tiles and chunks don't line up once a chunk is smaller than a tile,
+    // the canvas clips whatever hangs over the edge
+    int32_t tile_left = floorf(left / TILE_SIZE);
+    int32_t tile_right = ceilf((left + size) / TILE_SIZE);
+    int32_t tile_top = floorf(top / TILE_SIZE);
+    int32_t tile_bottom = ceilf((top + size) / TILE_SIZE);
+    rr_renderer_set_dimensions(renderer, CHUNK_PIXELS, CHUNK_PIXELS);
+    for (int32_t x = tile_left; x < tile_right; ++x)
+        for (int32_t y = tile_top; y < tile_bottom; ++y)
+        {
+            rr_renderer_set_transform(
+                renderer, raster, 0, ((x + 0.5f) * TILE_SIZE - left) * raster,
+                0, raster, ((y + 0.5f) * TILE_SIZE - top) * raster);
+            rr_renderer_context_state_init(renderer, &state);
+            draw_maze_tile(renderer, maze_tile_at(chunk->biome, x, y));
+            rr_renderer_context_state_free(renderer, &state);
+        }
+}
+
+static void resize_chunk_pool(uint32_t count)
+{
+    if (count > chunk_capacity)
+    {
+        struct background_chunk *cache =
+            realloc(chunk_cache, count * sizeof *chunk_cache);
+        // keep the old pool, get_chunk skips what doesn't fit
+        if (cache == NULL)
+            return;
+        chunk_cache = cache;
+        memset(chunk_cache + chunk_capacity, 0,
+               (count - chunk_capacity) * sizeof *chunk_cache);
+        chunk_capacity = count;
+    }
+    for (uint32_t i = count; i < chunk_count; ++i)
+    {
+        if (chunk_cache[i].initialized)
+            rr_renderer_set_dimensions(&chunk_cache[i].renderer, 1, 1);
+        chunk_cache[i].valid = 0;
+    }
+    chunk_count = count;
+}
+
+static struct background_chunk *get_chunk(uint8_t biome, float raster,
+                                          int32_t x, int32_t y)
+{
+    struct background_chunk *oldest = NULL;
+    for (uint32_t i = 0; i < chunk_count; ++i)
+    {
+        struct background_chunk *chunk = &chunk_cache[i];
+        if (chunk->valid && chunk->biome == biome && chunk->raster == raster &&
+            chunk->x == x && chunk->y == y)
+        {
+            chunk->last_used = background_frame;
+            return chunk;
+        }
+        if (!chunk->valid)
+        {
+            if (oldest == NULL || oldest->valid)
+                oldest = chunk;
+        }
+        else if (oldest == NULL ||
+                 (oldest->valid && chunk->last_used < oldest->last_used))
+            oldest = chunk;
+    }
+    // the pool always covers the view, this is only a safety net
+    if (oldest == NULL ||
+        (oldest->valid && oldest->last_used == background_frame))
+        return NULL;
+    if (!oldest->initialized)
+    {
+        rr_renderer_init(&oldest->renderer);
+        oldest->initialized = 1;
+    }
+    oldest->biome = biome;
+    oldest->raster = raster;
+    oldest->x = x;
+    oldest->y = y;
+    oldest->valid = 1;
+    oldest->last_used = background_frame;
+    render_chunk(oldest);
+    return oldest;
+}
 
 void render_background(struct rr_component_player_info *player_info,
                        struct rr_game *this)
@@ -32,86 +173,48 @@ void render_background(struct rr_component_player_info *player_info,
         return;
     struct rr_renderer *renderer = this->renderer;
     double scale = player_info->lerp_camera_fov * renderer->scale;
-    double leftX = player_info->lerp_camera_x - renderer->width / (2 * scale);
-    double rightX = player_info->lerp_camera_x + renderer->width / (2 * scale);
-    double topY = player_info->lerp_camera_y - renderer->height / (2 * scale);
-    double bottomY =
-        player_info->lerp_camera_y + renderer->height / (2 * scale);
-
-#define GRID_SIZE (512.0f)
-    double newLeftX = floorf(leftX / GRID_SIZE) * GRID_SIZE;
-    double newTopY = floorf(topY / GRID_SIZE) * GRID_SIZE;
-    // rr_renderer_scale(renderer, scale);
-    for (; newLeftX < rightX; newLeftX += GRID_SIZE)
-    {
-        for (double currY = newTopY; currY < bottomY; currY += GRID_SIZE)
-        {
-            uint32_t tile_index =
-                rr_get_hash((uint32_t)(((newLeftX + 8192) / GRID_SIZE + 1) *
-                                       ((currY + 8192) / GRID_SIZE + 2))) %
-                3;
-            struct rr_renderer_context_state state;
-            rr_renderer_context_state_init(renderer, &state);
-            rr_renderer_translate(renderer, newLeftX + GRID_SIZE / 2,
-                                  currY + GRID_SIZE / 2);
-            rr_renderer_scale(renderer, (GRID_SIZE + 2) / 256);
-            if (this->selected_biome == 0)
-                rr_renderer_draw_tile_hell_creek(renderer, tile_index);
-            else
-                rr_renderer_draw_tile_garden(renderer, tile_index);
-            rr_renderer_context_state_free(renderer, &state);
-        }
-    }
+    double view_width = renderer->width / scale;
+    double view_height = renderer->height / scale;
+    double leftX = player_info->lerp_camera_x - view_width / 2;
+    double topY = player_info->lerp_camera_y - view_height / 2;
 
-#undef GRID_SIZE
     struct rr_component_arena *arena =
         rr_simulation_get_arena(this->simulation, player_info->arena);
-    float grid_size = RR_MAZES[arena->biome].grid_size;
-    uint32_t maze_dim = RR_MAZES[arena->biome].maze_dim;
-    struct rr_maze_grid *grid = RR_MAZES[arena->biome].maze;
-    rr_renderer_set_fill(renderer, 0xff000000);
-    rr_renderer_set_global_alpha(renderer, 0.5f);
-    int32_t nx = floorf(leftX / grid_size);
-    int32_t ny = floorf(topY / grid_size);
-#define TILE_SIZE (256.0f)
-    double tileLeftX = floorf(leftX / TILE_SIZE) * TILE_SIZE;
-    double tileTopY = floorf(topY / TILE_SIZE) * TILE_SIZE;
-    for (; tileLeftX < rightX; tileLeftX += TILE_SIZE)
-    {
-        for (double tileY = tileTopY; tileY < bottomY; tileY += TILE_SIZE)
+    ++background_frame;
+    float raster = exp2f(ceilf(log2f(scale)));
+    if (raster < MIN_RASTER)
+        raster = MIN_RASTER;
+    else if (raster > MAX_RASTER)
+        raster = MAX_RASTER;
+    float size = CHUNK_PIXELS / raster;
+    // sized for the worst alignment so panning never resizes the pool
+    uint32_t columns = ceil(view_width / size) + 1;
+    uint32_t rows = ceil(view_height / size) + 1;
+    resize_chunk_pool((columns + 2) * (rows + 2));
+    int32_t chunk_left = floor(leftX / size);
+    int32_t chunk_top = floor(topY / size);
+    for (int32_t x = chunk_left; x < chunk_left + (int32_t)columns; ++x)
+        for (int32_t y = chunk_top; y < chunk_top + (int32_t)rows; ++y)
         {
-            int32_t tile_nx = floorf(tileLeftX / grid_size);
-            int32_t tile_ny = floorf(tileY / grid_size);
-            uint8_t tile =
-                (tile_nx < 0 || tile_ny < 0 || tile_nx >= maze_dim || tile_ny >= maze_dim)
-                    ? 0
-                    : grid[tile_ny * maze_dim + tile_nx].value;
-            struct rr_renderer_context_state tile_state;
-            rr_renderer_context_state_init(renderer, &tile_state);
-            rr_renderer_translate(renderer, tileLeftX + TILE_SIZE / 2,
-                                  tileY + TILE_SIZE / 2);
-            rr_renderer_set_global_alpha(renderer, 1.0f);
-            if (tile == 1)
-            {
-                rr_grass_draw(renderer);
-            }
-            else if (tile == 2)
-            {
-                rr_water_draw(renderer);
-            }
-            else if (tile == 0)
-            {
-                rr_dirt_draw(renderer);
-            }
-            else
-            {
-                rr_grass_draw(renderer);
-            }
-            rr_renderer_context_state_free(renderer, &tile_state);
+            struct background_chunk *chunk =
+                get_chunk(arena->biome, raster, x, y);
+            if (chunk == NULL)
+                continue;
+            struct rr_renderer_context_state state;
+            rr_renderer_context_state_init(renderer, &state);
+            rr_renderer_translate(renderer, (x + 0.5f) * size,
+                                  (y + 0.5f) * size);
+            // overlap by a pixel so the seams don't show
+            rr_renderer_scale(renderer, (CHUNK_PIXELS + 1.0f) / CHUNK_PIXELS /
+                                            raster);
+            rr_renderer_draw_image(renderer, &chunk->renderer);
+            rr_renderer_context_state_free(renderer, &state);
         }
-    }
-#undef TILE_SIZE
 }
+#undef MAX_RASTER
+#undef MIN_RASTER
+#undef CHUNK_PIXELS
+#undef TILE_SIZE
 
 void rr_component_arena_render(EntityIdx entity, struct rr_game *this,
                                struct rr_simulation *simulation)
@@ -68,19 +68,12 @@ void rr_component_health_render(EntityIdx entity, struct rr_game *game,
     {
         struct rr_component_flower *flower =
             rr_simulation_get_flower(simulation, entity);
-        rr_renderer_set_fill(renderer, 0xffffffff);
-        rr_renderer_set_stroke(renderer, 0xff000000);
-        rr_renderer_set_text_size(renderer, 12);
-        rr_renderer_set_text_align(renderer, 0);
-        rr_renderer_set_text_baseline(renderer, 0);
-        rr_renderer_stroke_text(renderer, flower->nickname, -length, -18);
-        rr_renderer_fill_text(renderer, flower->nickname, -length, -18);
-        rr_renderer_set_text_align(renderer, 2);
-        rr_renderer_set_text_baseline(renderer, 2);
+        rr_renderer_draw_stroked_text(renderer, flower->nickname, -length,
+                                      -18, 12, 0xffffffff, 0xff000000, 0, 0);
         char out[16];
         sprintf(out, "Lvl %d", flower->level);
-        rr_renderer_stroke_text(renderer, out, length, 18);
-        rr_renderer_fill_text(renderer, out, length, 18);
+        rr_renderer_draw_stroked_text(renderer, out, length, 18, 12,
+                                      0xffffffff, 0xff000000, 2, 2);
     }
     // the health bar
     rr_renderer_set_line_cap(renderer, 1);
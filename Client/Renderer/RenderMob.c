@@ -49,21 +49,24 @@ void rr_component_mob_render(EntityIdx entity, struct rr_game *game,
     rr_renderer_scale(renderer, RR_MOB_RARITY_SCALING[mob->rarity].radius);
     if (mob->id == rr_mob_id_meteor)
     {
-        struct rr_simulation_animation *particle = rr_particle_alloc(
-            &game->particle_manager, rr_animation_type_default);
+        struct rr_particle_manager *particles = &game->particle_manager;
+        uint32_t i = rr_particle_alloc(particles, rr_animation_type_default);
         float angle =
             rr_vector_theta(&physical->lerp_velocity) + M_PI - 0.5 + rr_frand();
         float dist = rr_frand() * 50;
-        rr_vector_from_polar(&particle->velocity,
+        struct rr_vector velocity;
+        rr_vector_from_polar(&velocity,
                              (rr_frand() * 5 + 5) *
                                  RR_MOB_RARITY_SCALING[mob->rarity].radius,
                              angle);
-        particle->x = physical->lerp_x + cosf(angle) * dist;
-        particle->y = physical->lerp_y + sinf(angle) * dist;
-        particle->size =
+        particles->velocity_x[i] = velocity.x;
+        particles->velocity_y[i] = velocity.y;
+        particles->x[i] = physical->lerp_x + cosf(angle) * dist;
+        particles->y[i] = physical->lerp_y + sinf(angle) * dist;
+        particles->size[i] =
             (4 + rr_frand() * 2) * RR_MOB_RARITY_SCALING[mob->rarity].radius;
-        particle->opacity = 0.8;
-        particle->color = 0xffab3423;
+        particles->opacity[i] = 0.8;
+        particles->color[i] = 0xffab3423;
     }
     if (physical->animation_timer > 2 * M_PI)
         physical->animation_timer = fmod(physical->animation_timer, 2 * M_PI);
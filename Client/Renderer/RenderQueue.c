@@ -0,0 +1,227 @@
+// Copyright (C) 2024  Paul Johnson
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <Client/Renderer/RenderQueue.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <Client/Game.h>
+#include <Client/Renderer/ComponentRender.h>
+#include <Client/Renderer/Renderer.h>
+#include <Client/Simulation.h>
+
+#define LAYER_SHIFT (56)
+#define MATERIAL_SHIFT (33)
+#define BLENDED_SHIFT (32)
+#define MATERIAL_MASK ((1 << (LAYER_SHIFT - MATERIAL_SHIFT)) - 1)
+
+// art reaches past the hitbox (legs, antennae, the deletion grow) and the
+// health bar hangs below it
+#define CULL_RADIUS_SCALE (2)
+#define CULL_MARGIN (60)
+
+// takes the camera center and half the screen size in world units. resets
+// the culling counters, so it's called once per frame before submitting
+void rr_render_queue_set_view(struct rr_render_queue *this, float x, float y,
+                              float half_width, float half_height)
+{
+    this->view_left = x - half_width;
+    this->view_right = x + half_width;
+    this->view_top = y - half_height;
+    this->view_bottom = y + half_height;
+    this->drawn = this->culled = 0;
+}
+
+void rr_render_queue_submit(struct rr_render_queue *this, uint8_t layer,
+                            uint32_t material, uint8_t blended,
+                            struct rr_simulation *simulation,
+                            EntityIdx entity)
+{
+    if (this->size == this->capacity)
+    {
+        this->capacity = this->capacity == 0 ? 256 : this->capacity * 2;
+        this->commands = realloc(this->commands,
+                                 this->capacity * sizeof *this->commands);
+    }
+    struct rr_render_command *command = &this->commands[this->size];
+    command->key = (uint64_t)layer << LAYER_SHIFT |
+                   (uint64_t)(material & MATERIAL_MASK) << MATERIAL_SHIFT |
+                   (uint64_t)(blended != 0) << BLENDED_SHIFT | this->size;
+    command->simulation = simulation;
+    command->entity = entity;
+    ++this->size;
+}
+
+static uint8_t is_visible(struct rr_render_queue *this,
+                          struct rr_simulation *simulation, EntityIdx entity)
+{
+    struct rr_component_physical *physical =
+        rr_simulation_get_physical(simulation, entity);
+    // drops being picked up fly towards the camera
+    if (physical->deletion_type == 2)
+        return 1;
+    float radius = physical->radius > physical->lerp_radius
+                       ? physical->radius
+                       : physical->lerp_radius;
+    float bound = radius * CULL_RADIUS_SCALE + CULL_MARGIN;
+    return physical->lerp_x + bound >= this->view_left &&
+           physical->lerp_x - bound <= this->view_right &&
+           physical->lerp_y + bound >= this->view_top &&
+           physical->lerp_y - bound <= this->view_bottom;
+}
+
+static uint8_t is_blended(struct rr_simulation *simulation, EntityIdx entity)
+{
+    if (rr_simulation_get_physical(simulation, entity)->deletion_animation !=
+        0)
+        return 1;
+    // same cutoff the mob and petal renderers use to skip the sprite cache
+    return rr_simulation_has_health(simulation, entity) &&
+           rr_simulation_get_health(simulation, entity)->damage_animation >=
+               0.1;
+}
+
+void rr_render_queue_submit_simulation(struct rr_render_queue *this,
+                                       struct rr_simulation *simulation)
+{
+    for (uint32_t i = 0; i < simulation->physical_count; ++i)
+    {
+        EntityIdx entity = simulation->physical_vector[i];
+        if (!is_visible(this, simulation, entity))
+        {
+            ++this->culled;
+            continue;
+        }
+        ++this->drawn;
+        if (rr_simulation_has_web(simulation, entity))
+            rr_render_queue_submit(this, rr_render_layer_web, 0, 0, simulation,
+                                   entity);
+        if (rr_simulation_has_health(simulation, entity))
+            rr_render_queue_submit(this, rr_render_layer_health, 0, 0,
+                                   simulation, entity);
+        if (rr_simulation_has_drop(simulation, entity))
+        {
+            struct rr_component_drop *drop =
+                rr_simulation_get_drop(simulation, entity);
+            rr_render_queue_submit(this, rr_render_layer_drop,
+                                   drop->id << 8 | drop->rarity, 0, simulation,
+                                   entity);
+        }
+        if (rr_simulation_has_mob(simulation, entity))
+        {
+            struct rr_component_mob *mob =
+                rr_simulation_get_mob(simulation, entity);
+            rr_render_queue_submit(this, rr_render_layer_mob,
+                                   mob->id << 8 | mob->rarity,
+                                   is_blended(simulation, entity), simulation,
+                                   entity);
+        }
+        if (rr_simulation_has_petal(simulation, entity))
+        {
+            struct rr_component_petal *petal =
+                rr_simulation_get_petal(simulation, entity);
+            rr_render_queue_submit(this, rr_render_layer_petal,
+                                   petal->id << 8 | petal->rarity,
+                                   is_blended(simulation, entity), simulation,
+                                   entity);
+        }
+        if (rr_simulation_has_flower(simulation, entity))
+            rr_render_queue_submit(this, rr_render_layer_flower, 0, 0,
+                                   simulation, entity);
+    }
+}
+
+static int compare_commands(void const *a, void const *b)
+{
+    uint64_t x = ((struct rr_render_command const *)a)->key;
+    uint64_t y = ((struct rr_render_command const *)b)->key;
+    return (x > y) - (x < y);
+}
+
+static void draw_command(struct rr_game *game, uint8_t layer,
+                         struct rr_simulation *simulation, EntityIdx entity)
+{
+    struct rr_component_physical *physical =
+        rr_simulation_get_physical(simulation, entity);
+    if (layer == rr_render_layer_health)
+        rr_renderer_translate(game->renderer, physical->lerp_x,
+                              physical->lerp_y + physical->radius + 30);
+    else
+        rr_renderer_translate(game->renderer, physical->lerp_x,
+                              physical->lerp_y);
+    switch (layer)
+    {
+    case rr_render_layer_web:
+        rr_component_web_render(entity, game, simulation);
+        break;
+    case rr_render_layer_health:
+        rr_component_health_render(entity, game, simulation);
+        break;
+    case rr_render_layer_drop:
+        rr_component_drop_render(entity, game, simulation);
+        break;
+    case rr_render_layer_mob:
+        rr_component_mob_render(entity, game, simulation);
+        break;
+    case rr_render_layer_petal:
+        rr_component_petal_render(entity, game, simulation);
+        break;
+    case rr_render_layer_flower:
+        rr_component_flower_render(entity, game, simulation);
+        break;
+    }
+}
+
+// draws every queued command up to and including the given layer. a run of
+// commands with the same key (minus the order) shares one save and restore
+// on the context, each draw in between only resets the c side state, since
+// the same material sets the same fill, stroke and line state every time
+void rr_render_queue_flush(struct rr_render_queue *this, struct rr_game *game,
+                           uint8_t last_layer)
+{
+    struct rr_renderer *renderer = game->renderer;
+    if (this->at == 0)
+        qsort(this->commands, this->size, sizeof *this->commands,
+              compare_commands);
+    struct rr_renderer_context_state run_state;
+    struct rr_renderer_context_state state;
+    uint64_t run = UINT64_MAX;
+    for (; this->at < this->size; ++this->at)
+    {
+        struct rr_render_command *command = &this->commands[this->at];
+        uint8_t layer = command->key >> LAYER_SHIFT;
+        if (layer > last_layer)
+            break;
+        if (command->key >> BLENDED_SHIFT != run)
+        {
+            if (run != UINT64_MAX)
+                rr_renderer_context_state_free(renderer, &run_state);
+            rr_renderer_context_state_init(renderer, &run_state);
+            run = command->key >> BLENDED_SHIFT;
+        }
+        memcpy(&state, &renderer->state, sizeof state);
+        draw_command(game, layer, command->simulation, command->entity);
+        float global_alpha = renderer->state.global_alpha;
+        memcpy(&renderer->state, &state, sizeof state);
+        if (global_alpha != state.global_alpha)
+            rr_renderer_set_global_alpha(renderer, state.global_alpha);
+        renderer->matrix_moddified = 1;
+    }
+    if (run != UINT64_MAX)
+        rr_renderer_context_state_free(renderer, &run_state);
+    if (this->at == this->size)
+        this->at = this->size = 0;
+}
@@ -0,0 +1,68 @@
+// Copyright (C) 2024  Paul Johnson
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <stdint.h>
+
+#include <Shared/Entity.h>
+
+struct rr_game;
+struct rr_simulation;
+
+// back to front. particles are drawn between mobs and petals
+enum rr_render_layer
+{
+    rr_render_layer_web,
+    rr_render_layer_health,
+    rr_render_layer_drop,
+    rr_render_layer_mob,
+    rr_render_layer_petal,
+    rr_render_layer_flower,
+    rr_render_layer_max
+};
+
+// key is layer, material (what gets drawn, so which sprites), whether alpha
+// or filters are in play, then submission order
+struct rr_render_command
+{
+    uint64_t key;
+    struct rr_simulation *simulation;
+    EntityIdx entity;
+};
+
+struct rr_render_queue
+{
+    struct rr_render_command *commands;
+    uint32_t size;
+    uint32_t capacity;
+    uint32_t at;
+    // world space rect on screen, anything outside is never submitted
+    float view_left;
+    float view_right;
+    float view_top;
+    float view_bottom;
+    uint32_t drawn;
+    uint32_t culled;
+};
+
+void rr_render_queue_set_view(struct rr_render_queue *, float, float, float,
+                              float);
+void rr_render_queue_submit(struct rr_render_queue *, uint8_t, uint32_t,
+                            uint8_t, struct rr_simulation *, EntityIdx);
+void rr_render_queue_submit_simulation(struct rr_render_queue *,
+                                       struct rr_simulation *);
+void rr_render_queue_flush(struct rr_render_queue *, struct rr_game *,
+                           uint8_t);
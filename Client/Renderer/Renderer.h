@@ -19,8 +19,6 @@
 
 #ifdef EMSCRIPTEN
 #include <emscripten.h>
-#else
-// todo: skia
 #endif
 
 // reason this is here is because this header is also included in the native.cc
@@ -29,6 +27,7 @@
 extern "C"
 {
 #endif
+// initial size of the instruction tape in words, it grows as needed
 #define INSTRUCTION_QUEUE_MAX_SIZE 16384
 
     struct rr_renderer_paint
@@ -54,15 +53,16 @@ extern "C"
 
     struct rr_renderer
     {
-#ifndef EMSCRIPTEN
-        // todo: skia
-#else
-    uint32_t context_id;
-#endif
+        // index of the canvas (or cairo surface on native builds)
+        uint32_t context_id;
         struct rr_renderer_context_state state;
         float width;
         float height;
         float scale;
+        // screen position of the offscreen layer being drawn into instead,
+        // taken off every transform that goes on the tape
+        float origin_x;
+        float origin_y;
 
         uint8_t matrix_moddified;
     };
@@ -76,6 +76,21 @@ extern "C"
         void (*render)(struct rr_renderer *);
     };
 
+    struct rr_renderer_tape_stats
+    {
+        uint32_t instructions;
+        uint32_t bytes;
+        double execute_time; // ms spent replaying the tape
+    };
+
+    struct rr_renderer_sprite_cache_stats
+    {
+        uint32_t hits;
+        uint32_t misses;
+        uint32_t evictions;
+        uint32_t bytes; // canvas memory held by the atlas pages
+    };
+
     struct rr_renderer_spritesheet
     {
         struct rr_renderer renderer;
@@ -165,6 +180,27 @@ extern "C"
     void rr_renderer_execute_instructions();
     uint32_t rr_renderer_get_op_size();
     void rr_renderer_reset_instruction_queue();
+    // totals for the last finished frame
+    void rr_renderer_get_tape_stats(struct rr_renderer_tape_stats *);
+    // a run of instructions since a mark can be fingerprinted and dropped
+    // again when it would redraw exactly what an offscreen layer holds. the
+    // hash is 0 if anything since the mark targets another context
+    uint32_t rr_renderer_tape_mark();
+    uint64_t rr_renderer_tape_hash(uint32_t, uint32_t);
+    void rr_renderer_tape_rewind(uint32_t);
+
+    // blits the sprite from the atlas, rasterizing it there first if needed.
+    // key identifies the drawing, w and h bound it around the origin. returns
+    // 0 if it had to draw directly instead
+    uint8_t rr_renderer_draw_cached(struct rr_renderer *, uint32_t, float,
+                                    float,
+                                    void (*)(struct rr_renderer *, void *),
+                                    void *);
+    // drops every sprite, for when the font or art they were drawn with changes
+    void rr_renderer_sprite_cache_clear();
+    void rr_renderer_sprite_cache_end_frame();
+    void rr_renderer_get_sprite_cache_stats(
+        struct rr_renderer_sprite_cache_stats *);
 #ifdef __cplusplus
 }
 #endif
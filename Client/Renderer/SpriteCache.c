@@ -0,0 +1,281 @@
+// Copyright (C) 2024  Paul Johnson
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <Client/Renderer/Renderer.h>
+
+#include <math.h>
+#include <string.h>
+
+// sprites are rasterized on first use into shelf packed atlas pages, once per
+// (sprite, zoom bucket, quantized color filter). when every page is full the
+// least recently used page that wasn't touched this frame is thrown out whole
+#define PAGE_SIZE 1024
+#define MAX_PAGES 8
+#define MAX_ENTRIES 4096
+#define TABLE_SIZE 8192
+#define MAX_SPRITE_SIZE 384
+#define SHELF_ROUND 16
+// half octave zoom buckets
+#define MIN_ZOOM_BUCKET (-12)
+#define MAX_ZOOM_BUCKET 6
+
+struct atlas_page
+{
+    struct rr_renderer renderer;
+    uint32_t last_used;
+    uint16_t shelf_x;
+    uint16_t shelf_y;
+    uint16_t shelf_h;
+    uint8_t initialized;
+};
+
+struct atlas_entry
+{
+    uint64_t key;
+    float scale;
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+    uint8_t page;
+};
+
+static struct atlas_page pages[MAX_PAGES];
+static struct atlas_entry entries[MAX_ENTRIES];
+static uint32_t entry_count = 0;
+// entry index + 1, 0 is an empty slot
+static uint16_t table[TABLE_SIZE];
+static uint32_t frame = 1;
+static struct rr_renderer_sprite_cache_stats stats = {0};
+static struct rr_renderer_sprite_cache_stats last_stats = {0};
+
+static uint32_t table_slot(uint64_t key)
+{
+    return (key * 0x9e3779b97f4a7c15ull) >> (64 - 13);
+}
+
+static void table_insert(uint32_t index)
+{
+    uint32_t slot = table_slot(entries[index].key);
+    while (table[slot] != 0)
+        slot = (slot + 1) & (TABLE_SIZE - 1);
+    table[slot] = index + 1;
+}
+
+static struct atlas_entry *table_find(uint64_t key)
+{
+    uint32_t slot = table_slot(key);
+    while (table[slot] != 0)
+    {
+        struct atlas_entry *entry = &entries[table[slot] - 1];
+        if (entry->key == key)
+            return entry;
+        slot = (slot + 1) & (TABLE_SIZE - 1);
+    }
+    return NULL;
+}
+
+static void evict_page(uint8_t page)
+{
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < entry_count; ++i)
+        if (entries[i].page != page)
+            entries[kept++] = entries[i];
+    entry_count = kept;
+    memset(table, 0, sizeof table);
+    for (uint32_t i = 0; i < entry_count; ++i)
+        table_insert(i);
+    // resizing the canvas clears it. this is immediate, which is fine since
+    // nothing on this frame's tape reads from or draws to the page
+    rr_renderer_set_dimensions(&pages[page].renderer, PAGE_SIZE, PAGE_SIZE);
+    pages[page].shelf_x = pages[page].shelf_y = pages[page].shelf_h = 0;
+    ++stats.evictions;
+}
+
+static uint8_t page_fits_shelf(struct atlas_page *page, uint32_t w, uint32_t h)
+{
+    return page->initialized && page->shelf_x + w <= PAGE_SIZE &&
+           h <= page->shelf_h;
+}
+
+static uint8_t page_fits_new_shelf(struct atlas_page *page, uint32_t h)
+{
+    return page->initialized && page->shelf_y + page->shelf_h + h <= PAGE_SIZE;
+}
+
+static int32_t allocate(uint32_t w, uint32_t h, uint16_t *x, uint16_t *y)
+{
+    int32_t found = -1;
+    for (uint32_t i = 0; i < MAX_PAGES && found < 0; ++i)
+        if (page_fits_shelf(&pages[i], w, h))
+            found = i;
+    for (uint32_t i = 0; i < MAX_PAGES && found < 0; ++i)
+        if (page_fits_new_shelf(&pages[i], h))
+        {
+            pages[i].shelf_y += pages[i].shelf_h;
+            pages[i].shelf_x = 0;
+            pages[i].shelf_h = h;
+            found = i;
+        }
+    for (uint32_t i = 0; i < MAX_PAGES && found < 0; ++i)
+        if (!pages[i].initialized)
+        {
+            rr_renderer_init(&pages[i].renderer);
+            rr_renderer_set_dimensions(&pages[i].renderer, PAGE_SIZE,
+                                       PAGE_SIZE);
+            pages[i].initialized = 1;
+            stats.bytes += PAGE_SIZE * PAGE_SIZE * 4;
+            pages[i].shelf_h = h;
+            found = i;
+        }
+    if (found < 0)
+    {
+        for (uint32_t i = 0; i < MAX_PAGES; ++i)
+            if (pages[i].last_used != frame &&
+                (found < 0 || pages[i].last_used < pages[found].last_used))
+                found = i;
+        if (found < 0)
+            return -1;
+        evict_page(found);
+        pages[found].shelf_h = h;
+    }
+    struct atlas_page *page = &pages[found];
+    *x = page->shelf_x;
+    *y = page->shelf_y;
+    page->shelf_x += w;
+    return found;
+}
+
+uint8_t rr_renderer_draw_cached(struct rr_renderer *this, uint32_t key,
+                                float w, float h,
+                                void (*render)(struct rr_renderer *, void *),
+                                void *captures)
+{
+    float *m = this->state.transform_matrix;
+    float zoom = sqrtf(fabsf(m[0] * m[4] - m[1] * m[3]));
+    if (zoom == 0)
+        return 0;
+    int32_t bucket = roundf(2 * log2f(zoom));
+    if (bucket < MIN_ZOOM_BUCKET)
+        bucket = MIN_ZOOM_BUCKET;
+    if (bucket > MAX_ZOOM_BUCKET)
+        bucket = MAX_ZOOM_BUCKET;
+    float scale = exp2f(bucket * 0.5f);
+    // one pixel of padding so bilinear sampling doesn't bleed neighbours in
+    uint32_t pw = ceilf(w * scale) + 2;
+    uint32_t ph = (uint32_t)(ceilf(h * scale) + 2 + SHELF_ROUND - 1) &
+                  ~(SHELF_ROUND - 1);
+    if (pw > MAX_SPRITE_SIZE || ph > MAX_SPRITE_SIZE)
+    {
+        render(this, captures);
+        return 0;
+    }
+
+    // filter color at 4 bits a channel, amount in 15 steps
+    uint32_t filter = 0;
+    uint32_t amount = this->state.filter.amount * 15 + 0.5f;
+    if (amount != 0)
+    {
+        uint32_t c = this->state.filter.color;
+        filter = ((c >> 20 & 15) << 12 | (c >> 12 & 15) << 8 |
+                  (c >> 4 & 15) << 4 | amount);
+    }
+    uint64_t full_key = (uint64_t)key << 32 |
+                        (uint32_t)(bucket - MIN_ZOOM_BUCKET) << 16 | filter;
+
+    struct atlas_entry *entry = table_find(full_key);
+    if (entry == NULL)
+    {
+        uint16_t x;
+        uint16_t y;
+        int32_t page = -1;
+        if (entry_count < MAX_ENTRIES)
+            page = allocate(pw, ph, &x, &y);
+        if (page < 0)
+        {
+            ++stats.misses;
+            render(this, captures);
+            return 0;
+        }
+        entry = &entries[entry_count];
+        entry->key = full_key;
+        entry->scale = scale;
+        entry->x = x;
+        entry->y = y;
+        entry->w = pw;
+        entry->h = ph;
+        entry->page = page;
+        table_insert(entry_count++);
+
+        struct rr_renderer *atlas = &pages[page].renderer;
+        struct rr_renderer_context_state state;
+        rr_renderer_context_state_init(atlas, &state);
+        rr_renderer_set_transform(atlas, 1, 0, 0, 0, 1, 0);
+        rr_renderer_begin_path(atlas);
+        rr_renderer_rect(atlas, x, y, pw, ph);
+        rr_renderer_clip(atlas);
+        rr_renderer_set_transform(atlas, scale, 0, x + pw * 0.5f, 0, scale,
+                                  y + ph * 0.5f);
+        if (amount != 0)
+        {
+            uint32_t red = (filter >> 12 & 15) * 17;
+            uint32_t green = (filter >> 8 & 15) * 17;
+            uint32_t blue = (filter >> 4 & 15) * 17;
+            atlas->state.filter.color =
+                0xff000000 | red << 16 | green << 8 | blue;
+            atlas->state.filter.amount = amount / 15.0f;
+        }
+        render(atlas, captures);
+        rr_renderer_context_state_free(atlas, &state);
+        ++stats.misses;
+    }
+    else
+        ++stats.hits;
+
+    pages[entry->page].last_used = frame;
+    rr_renderer_scale(this, 1 / entry->scale);
+    rr_renderer_draw_clipped_image(this, &pages[entry->page].renderer,
+                                   entry->x + entry->w * 0.5f,
+                                   entry->y + entry->h * 0.5f, entry->w,
+                                   entry->h, 0, 0);
+    rr_renderer_scale(this, entry->scale);
+    return 1;
+}
+
+void rr_renderer_sprite_cache_clear()
+{
+    for (uint32_t i = 0; i < MAX_PAGES; ++i)
+    {
+        if (!pages[i].initialized)
+            continue;
+        rr_renderer_set_dimensions(&pages[i].renderer, PAGE_SIZE, PAGE_SIZE);
+        pages[i].shelf_x = pages[i].shelf_y = pages[i].shelf_h = 0;
+    }
+    entry_count = 0;
+    memset(table, 0, sizeof table);
+}
+
+void rr_renderer_sprite_cache_end_frame()
+{
+    last_stats = stats;
+    stats.hits = stats.misses = stats.evictions = 0;
+    ++frame;
+}
+
+void rr_renderer_get_sprite_cache_stats(
+    struct rr_renderer_sprite_cache_stats *out)
+{
+    *out = last_stats;
+}
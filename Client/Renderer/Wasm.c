@@ -17,45 +17,65 @@
 
 #include <emscripten.h>
 #include <math.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <Shared/Utilities.h>
 
-struct renderer_args
+// every record is a header word (op | context << 8 | payload words << 24)
+// followed by only as many payload words as the op needs. the tape grows
+// instead of flushing halfway through a frame
+union tape_word
 {
-    uint8_t type;
-    uint16_t context_id;
-    uint16_t context_id_2;
-    float args[6];
-    char const *text_arg;
+    float f;
+    uint32_t u;
 };
 
-static struct renderer_args instruction_tape[INSTRUCTION_QUEUE_MAX_SIZE] = {0};
+static union tape_word *instruction_tape = NULL;
+static uint32_t tape_size = 0;
+static uint32_t tape_capacity = 0;
 static uint32_t instruction_size = 0;
-static uint32_t rollovers = 0;
+static struct rr_renderer_tape_stats frame_stats = {0};
+static struct rr_renderer_tape_stats last_frame_stats = {0};
+
+static union tape_word *tape_push(struct rr_renderer *this, uint8_t op,
+                                  uint32_t words)
+{
+    if (tape_size + words + 1 > tape_capacity)
+    {
+        uint32_t capacity =
+            tape_capacity == 0 ? INSTRUCTION_QUEUE_MAX_SIZE : tape_capacity * 2;
+        union tape_word *tape =
+            realloc(instruction_tape, capacity * sizeof *instruction_tape);
+        // a half recorded frame can't be flushed (cache layers rewind into
+        // it), so there is nothing sensible to fall back to
+        if (tape == NULL)
+        {
+            fputs("renderer: out of memory growing the instruction tape\n",
+                  stderr);
+            abort();
+        }
+        instruction_tape = tape;
+        tape_capacity = capacity;
+    }
+    union tape_word *record = &instruction_tape[tape_size];
+    record[0].u = op | (uint32_t)this->context_id << 8 | words << 24;
+    tape_size += words + 1;
+    ++instruction_size;
+    return record + 1;
+}
 
 static void update_if_transformed(struct rr_renderer *this)
 {
     if (this->matrix_moddified)
     {
         this->matrix_moddified = 0;
-        instruction_tape[instruction_size].type = 9;
-        instruction_tape[instruction_size].context_id = this->context_id;
-        instruction_tape[instruction_size].args[0] =
-            this->state.transform_matrix[0];
-        instruction_tape[instruction_size].args[1] =
-            this->state.transform_matrix[1];
-        instruction_tape[instruction_size].args[2] =
-            this->state.transform_matrix[2];
-        instruction_tape[instruction_size].args[3] =
-            this->state.transform_matrix[3];
-        instruction_tape[instruction_size].args[4] =
-            this->state.transform_matrix[4];
-        instruction_tape[instruction_size].args[5] =
-            this->state.transform_matrix[5];
-        if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-            rr_renderer_execute_instructions();
+        union tape_word *args = tape_push(this, 9, 6);
+        for (uint32_t i = 0; i < 6; ++i)
+            args[i].f = this->state.transform_matrix[i];
+        args[2].f -= this->origin_x;
+        args[5].f -= this->origin_y;
     }
 }
 
@@ -79,7 +99,7 @@ void rr_renderer_set_dimensions(struct rr_renderer *this, float w, float h)
         this->context_id, w, h);
 }
 
-void rr_renderer_set_fill(struct rr_renderer *this, uint32_t c)
+static uint32_t apply_filter(struct rr_renderer *this, uint32_t c)
 {
     float a = this->state.filter.amount;
     uint32_t fc = this->state.filter.color;
@@ -89,100 +109,53 @@ void rr_renderer_set_fill(struct rr_renderer *this, uint32_t c)
         rr_fclamp((((c >> 8) & 255) * (1 - a) + ((fc >> 8) & 255) * a), 0, 255);
     uint8_t blue =
         rr_fclamp((((c >> 0) & 255) * (1 - a) + ((fc >> 0) & 255) * a), 0, 255);
-    instruction_tape[instruction_size].type = 0;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = red;
-    instruction_tape[instruction_size].args[1] = green;
-    instruction_tape[instruction_size].args[2] = blue;
-    instruction_tape[instruction_size].args[3] =
-        (float)(c >> 24) * 1.0f / 255.0f;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    return (c & 0xff000000) | red << 16 | green << 8 | blue;
+}
+
+void rr_renderer_set_fill(struct rr_renderer *this, uint32_t c)
+{
+    tape_push(this, 0, 1)[0].u = apply_filter(this, c);
 }
 
 void rr_renderer_set_stroke(struct rr_renderer *this, uint32_t c)
 {
-    float a = this->state.filter.amount;
-    uint32_t fc = this->state.filter.color;
-    uint8_t red = rr_fclamp(
-        (((c >> 16) & 255) * (1 - a) + ((fc >> 16) & 255) * a), 0, 255);
-    uint8_t green =
-        rr_fclamp((((c >> 8) & 255) * (1 - a) + ((fc >> 8) & 255) * a), 0, 255);
-    uint8_t blue =
-        rr_fclamp((((c >> 0) & 255) * (1 - a) + ((fc >> 0) & 255) * a), 0, 255);
-    instruction_tape[instruction_size].type = 1;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = red;
-    instruction_tape[instruction_size].args[1] = green;
-    instruction_tape[instruction_size].args[2] = blue;
-    instruction_tape[instruction_size].args[3] =
-        (float)(c >> 24) * 1.0f / 255.0f;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    tape_push(this, 1, 1)[0].u = apply_filter(this, c);
 }
 
 void rr_renderer_set_line_width(struct rr_renderer *this, float w)
 {
-    instruction_tape[instruction_size].type = 2;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = w;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    tape_push(this, 2, 1)[0].f = w;
 }
 
 void rr_renderer_set_text_size(struct rr_renderer *this, float s)
 {
-    instruction_tape[instruction_size].type = 3;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = s;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    tape_push(this, 3, 1)[0].f = s;
 }
 
 void rr_renderer_set_global_alpha(struct rr_renderer *this, float a)
 {
-    instruction_tape[instruction_size].type = 4;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = a;
+    tape_push(this, 4, 1)[0].f = a;
     this->state.global_alpha = a;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
 }
 
 void rr_renderer_set_line_cap(struct rr_renderer *this, uint8_t l)
 {
-    instruction_tape[instruction_size].type = 5;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = l;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    tape_push(this, 5, 1)[0].u = l;
 }
 
 void rr_renderer_set_line_join(struct rr_renderer *this, uint8_t l)
 {
-    instruction_tape[instruction_size].type = 6;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = l;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    tape_push(this, 6, 1)[0].u = l;
 }
 
 void rr_renderer_set_text_align(struct rr_renderer *this, uint8_t l)
 {
-    instruction_tape[instruction_size].type = 7;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = l;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    tape_push(this, 7, 1)[0].u = l;
 }
 
 void rr_renderer_set_text_baseline(struct rr_renderer *this, uint8_t l)
 {
-    instruction_tape[instruction_size].type = 8;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = l;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    tape_push(this, 8, 1)[0].u = l;
 }
 
 void rr_renderer_update_transform(struct rr_renderer *this)
@@ -190,125 +163,92 @@ void rr_renderer_update_transform(struct rr_renderer *this)
     this->matrix_moddified = 1;
 }
 
-void rr_renderer_save(struct rr_renderer *this)
-{
-    instruction_tape[instruction_size].type = 10;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
-}
+void rr_renderer_save(struct rr_renderer *this) { tape_push(this, 10, 0); }
 
 void rr_renderer_restore(struct rr_renderer *this)
 {
     this->matrix_moddified = 1;
-    instruction_tape[instruction_size].type = 11;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    tape_push(this, 11, 0);
 }
 
 void rr_renderer_begin_path(struct rr_renderer *this)
 {
     update_if_transformed(this);
-    instruction_tape[instruction_size].type = 12;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    tape_push(this, 12, 0);
 }
 
 void rr_renderer_move_to(struct rr_renderer *this, float x, float y)
 {
     update_if_transformed(this);
-    instruction_tape[instruction_size].type = 13;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = x;
-    instruction_tape[instruction_size].args[1] = y;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    union tape_word *args = tape_push(this, 13, 2);
+    args[0].f = x;
+    args[1].f = y;
 }
 
 void rr_renderer_line_to(struct rr_renderer *this, float x, float y)
 {
     update_if_transformed(this);
-    instruction_tape[instruction_size].type = 14;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = x;
-    instruction_tape[instruction_size].args[1] = y;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    union tape_word *args = tape_push(this, 14, 2);
+    args[0].f = x;
+    args[1].f = y;
 }
 
 void rr_renderer_quadratic_curve_to(struct rr_renderer *this, float x1,
                                     float y1, float x, float y)
 {
     update_if_transformed(this);
-    instruction_tape[instruction_size].type = 15;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = x1;
-    instruction_tape[instruction_size].args[1] = y1;
-    instruction_tape[instruction_size].args[2] = x;
-    instruction_tape[instruction_size].args[3] = y;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    union tape_word *args = tape_push(this, 15, 4);
+    args[0].f = x1;
+    args[1].f = y1;
+    args[2].f = x;
+    args[3].f = y;
 }
 
 void rr_renderer_bezier_curve_to(struct rr_renderer *this, float x1, float y1,
                                  float x2, float y2, float x, float y)
 {
     update_if_transformed(this);
-    instruction_tape[instruction_size].type = 16;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = x1;
-    instruction_tape[instruction_size].args[1] = y1;
-    instruction_tape[instruction_size].args[2] = x2;
-    instruction_tape[instruction_size].args[3] = y2;
-    instruction_tape[instruction_size].args[4] = x;
-    instruction_tape[instruction_size].args[5] = y;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    union tape_word *args = tape_push(this, 16, 6);
+    args[0].f = x1;
+    args[1].f = y1;
+    args[2].f = x2;
+    args[3].f = y2;
+    args[4].f = x;
+    args[5].f = y;
 }
 void rr_renderer_partial_arc(struct rr_renderer *this, float x, float y,
                              float r, float sa, float ea, uint8_t ccw)
 {
     update_if_transformed(this);
-    instruction_tape[instruction_size].type = 17;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = x;
-    instruction_tape[instruction_size].args[1] = y;
-    instruction_tape[instruction_size].args[2] = r;
-    instruction_tape[instruction_size].args[3] = sa;
-    instruction_tape[instruction_size].args[4] = ea;
-    instruction_tape[instruction_size].args[5] = ccw;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    union tape_word *args = tape_push(this, 17, 6);
+    args[0].f = x;
+    args[1].f = y;
+    args[2].f = r;
+    args[3].f = sa;
+    args[4].f = ea;
+    args[5].u = ccw;
 }
 
 void rr_renderer_ellipse(struct rr_renderer *this, float x, float y, float rx,
                          float ry)
 {
     update_if_transformed(this);
-    instruction_tape[instruction_size].type = 18;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = x;
-    instruction_tape[instruction_size].args[1] = y;
-    instruction_tape[instruction_size].args[2] = rx;
-    instruction_tape[instruction_size].args[3] = ry;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    union tape_word *args = tape_push(this, 18, 4);
+    args[0].f = x;
+    args[1].f = y;
+    args[2].f = rx;
+    args[3].f = ry;
 }
 
 void rr_renderer_rect(struct rr_renderer *this, float x, float y, float w,
                       float h)
 {
     update_if_transformed(this);
-    instruction_tape[instruction_size].type = 19;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = x;
-    instruction_tape[instruction_size].args[1] = y;
-    instruction_tape[instruction_size].args[2] = w;
-    instruction_tape[instruction_size].args[3] = h;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    union tape_word *args = tape_push(this, 19, 4);
+    args[0].f = x;
+    args[1].f = y;
+    args[2].f = w;
+    args[3].f = h;
 }
 
 void rr_renderer_draw_clipped_image(struct rr_renderer *this,
@@ -317,17 +257,14 @@ void rr_renderer_draw_clipped_image(struct rr_renderer *this,
                                     float dy)
 {
     update_if_transformed(this);
-    instruction_tape[instruction_size].type = 20;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].context_id_2 = image->context_id;
-    instruction_tape[instruction_size].args[0] = sx - sw / 2;
-    instruction_tape[instruction_size].args[1] = sy - sh / 2;
-    instruction_tape[instruction_size].args[2] = sw;
-    instruction_tape[instruction_size].args[3] = sh;
-    instruction_tape[instruction_size].args[4] = dx - sw / 2;
-    instruction_tape[instruction_size].args[5] = dy - sh / 2;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    union tape_word *args = tape_push(this, 20, 7);
+    args[0].u = image->context_id;
+    args[1].f = sx - sw / 2;
+    args[2].f = sy - sh / 2;
+    args[3].f = sw;
+    args[4].f = sh;
+    args[5].f = dx - sw / 2;
+    args[6].f = dy - sh / 2;
 }
 
 void rr_renderer_draw_translated_image(struct rr_renderer *this,
@@ -369,95 +306,70 @@ void rr_renderer_fill_rect(struct rr_renderer *this, float x, float y, float w,
                            float h)
 {
     update_if_transformed(this);
-    instruction_tape[instruction_size].type = 21;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = x;
-    instruction_tape[instruction_size].args[1] = y;
-    instruction_tape[instruction_size].args[2] = w;
-    instruction_tape[instruction_size].args[3] = h;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    union tape_word *args = tape_push(this, 21, 4);
+    args[0].f = x;
+    args[1].f = y;
+    args[2].f = w;
+    args[3].f = h;
 }
 
 void rr_renderer_stroke_rect(struct rr_renderer *this, float x, float y,
                              float w, float h)
 {
     update_if_transformed(this);
-    instruction_tape[instruction_size].type = 22;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = x;
-    instruction_tape[instruction_size].args[1] = y;
-    instruction_tape[instruction_size].args[2] = w;
-    instruction_tape[instruction_size].args[3] = h;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    union tape_word *args = tape_push(this, 22, 4);
+    args[0].f = x;
+    args[1].f = y;
+    args[2].f = w;
+    args[3].f = h;
 }
 
 void rr_renderer_fill(struct rr_renderer *this)
 {
     update_if_transformed(this);
-    instruction_tape[instruction_size].type = 23;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    tape_push(this, 23, 0);
 }
 
 void rr_renderer_stroke(struct rr_renderer *this)
 {
     update_if_transformed(this);
-    instruction_tape[instruction_size].type = 24;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    tape_push(this, 24, 0);
 }
 
 void rr_renderer_clip(struct rr_renderer *this)
 {
     update_if_transformed(this);
-    instruction_tape[instruction_size].type = 25;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    tape_push(this, 25, 0);
 }
 
 void rr_renderer_clip2(struct rr_renderer *this)
 {
     update_if_transformed(this);
-    instruction_tape[instruction_size].type = 26;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    tape_push(this, 26, 0);
 }
 
-void rr_renderer_fill_text(struct rr_renderer *this, char const *c, float x,
-                           float y)
+static void push_text(struct rr_renderer *this, uint8_t op, char const *c,
+                      float x, float y)
 {
     update_if_transformed(this);
-    instruction_tape[instruction_size].type = 27;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = x;
-    instruction_tape[instruction_size].args[1] = y;
+    union tape_word *args = tape_push(this, op, 3);
+    args[0].f = x;
+    args[1].f = y;
     uint32_t len = strlen(c) + 1;
     char *text = malloc(len * (sizeof *text));
     memcpy(text, c, len * sizeof *text);
-    instruction_tape[instruction_size].text_arg = text;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    args[2].u = (uint32_t)(uintptr_t)text;
+}
+
+void rr_renderer_fill_text(struct rr_renderer *this, char const *c, float x,
+                           float y)
+{
+    push_text(this, 27, c, x, y);
 }
 void rr_renderer_stroke_text(struct rr_renderer *this, char const *c, float x,
                              float y)
 {
-    update_if_transformed(this);
-    instruction_tape[instruction_size].type = 28;
-    instruction_tape[instruction_size].context_id = this->context_id;
-    instruction_tape[instruction_size].args[0] = x;
-    instruction_tape[instruction_size].args[1] = y;
-    uint32_t len = strlen(c) + 1;
-    char *text = malloc(len * (sizeof *text));
-    memcpy(text, c, len * sizeof *text);
-    instruction_tape[instruction_size].text_arg = text;
-    if (++instruction_size == INSTRUCTION_QUEUE_MAX_SIZE)
-        rr_renderer_execute_instructions();
+    push_text(this, 28, c, x, y);
 }
 
 float rr_renderer_get_text_size(char const *c)
@@ -475,158 +387,211 @@ float rr_renderer_get_text_size(char const *c)
 
 void rr_renderer_execute_instructions()
 {
-    ++rollovers;
-    EM_ASM(
+    frame_stats.instructions += instruction_size;
+    frame_stats.bytes += tape_size * sizeof *instruction_tape;
+    frame_stats.execute_time += EM_ASM_DOUBLE(
         {
-            let instr = $0;
-            for (let n = 0; n < $1; ++n)
+            const start = performance.now();
+            // fill and stroke colors repeat constantly, so the css string for
+            // each 32 bit color is only built once
+            if (!Module.tapeColors)
+                Module.tapeColors = new Map();
+            const colors = Module.tapeColors;
+            const color = function(c)
             {
-                const ctx_id = HEAPU16[instr + 2 >> 1];
-                const ctx_id_2 = HEAPU16[instr + 4 >> 1];
-                const args = HEAPF32.subarray(instr + 8 >> 2, instr + 32 >> 2);
-                const char_arg = HEAPU32[instr + 32 >> 2];
+                let style = colors.get(c);
+                if (style === undefined)
+                {
+                    if (colors.size >= 4096)
+                        colors.clear();
+                    style = "rgba(" + ((c >>> 16) & 255) + ',' +
+                            ((c >>> 8) & 255) + ',' + (c & 255) + ',' +
+                            (c >>> 24) / 255 + ')';
+                    colors.set(c, style);
+                }
+                return style;
+            };
+            let at = $0 >> 2;
+            const end = at + $1;
+            while (at < end)
+            {
+                const header = HEAPU32[at];
+                const ctx = Module.ctxs[(header >>> 8) & 65535];
+                const a = at + 1;
+                at = a + (header >>> 24);
                 let str;
-                switch (HEAPU8[instr])
+                switch (header & 255)
                 {
                 case 0:
-                    Module.ctxs[ctx_id].fillStyle = "rgba(" + args[0] + ',' +
-                                                    args[1] + ',' + args[2] +
-                                                    ',' + args[3] + ')';
+                    ctx.fillStyle = color(HEAPU32[a]);
                     break;
                 case 1:
-                    Module.ctxs[ctx_id].strokeStyle = "rgba(" + args[0] + ',' +
-                                                      args[1] + ',' + args[2] +
-                                                      ',' + args[3] + ')';
+                    ctx.strokeStyle = color(HEAPU32[a]);
                     break;
                 case 2:
-                    Module.ctxs[ctx_id].lineWidth = args[0];
+                    ctx.lineWidth = HEAPF32[a];
                     break;
                 case 3:
-                    Module.ctxs[ctx_id].font = args[0] + "px Ubuntu";
+                    ctx.font = HEAPF32[a] + "px Ubuntu";
                     break;
                 case 4:
-                    Module.ctxs[ctx_id].globalAlpha = args[0];
+                    ctx.globalAlpha = HEAPF32[a];
                     break;
                 case 5:
-                    if (args[0] == 0)
-                        Module.ctxs[ctx_id].lineCap = 'butt';
-                    else if (args[0] == 1)
-                        Module.ctxs[ctx_id].lineCap = 'round';
-                    else if (args[0] == 2)
-                        Module.ctxs[ctx_id].lineCap = 'square';
+                    ctx.lineCap = [ 'butt', 'round', 'square' ][HEAPU32[a]];
                     break;
                 case 6:
-                    if (args[0] == 0)
-                        Module.ctxs[ctx_id].lineJoin = 'bevel';
-                    else if (args[0] == 1)
-                        Module.ctxs[ctx_id].lineJoin = 'round';
-                    else if (args[0] == 2)
-                        Module.ctxs[ctx_id].lineJoin = 'miter';
+                    ctx.lineJoin = [ 'bevel', 'round', 'miter' ][HEAPU32[a]];
                     break;
                 case 7:
-                    if (args[0] == 0)
-                        Module.ctxs[ctx_id].textAlign = 'left';
-                    else if (args[0] == 1)
-                        Module.ctxs[ctx_id].textAlign = 'center';
-                    else if (args[0] == 2)
-                        Module.ctxs[ctx_id].textAlign = 'right';
+                    ctx.textAlign = [ 'left', 'center', 'right' ][HEAPU32[a]];
                     break;
                 case 8:
-                    if (args[0] == 0)
-                        Module.ctxs[ctx_id].textBaseline = 'top';
-                    else if (args[0] == 1)
-                        Module.ctxs[ctx_id].textBaseline = 'middle';
-                    else if (args[0] == 2)
-                        Module.ctxs[ctx_id].textBaseline = 'bottom';
+                    ctx.textBaseline =
+                        [ 'top', 'middle', 'bottom' ][HEAPU32[a]];
                     break;
                 case 9:
-                    Module.ctxs[ctx_id].setTransform(args[0], args[1], args[3],
-                                                     args[4], args[2], args[5]);
+                    ctx.setTransform(HEAPF32[a], HEAPF32[a + 1],
+                                     HEAPF32[a + 3], HEAPF32[a + 4],
+                                     HEAPF32[a + 2], HEAPF32[a + 5]);
                     break;
                 case 10:
-                    Module.ctxs[ctx_id].save();
+                    ctx.save();
                     break;
                 case 11:
-                    Module.ctxs[ctx_id].restore();
+                    ctx.restore();
                     break;
                 case 12:
-                    Module.ctxs[ctx_id].beginPath();
+                    ctx.beginPath();
                     break;
                 case 13:
-                    Module.ctxs[ctx_id].moveTo(args[0], args[1]);
+                    ctx.moveTo(HEAPF32[a], HEAPF32[a + 1]);
                     break;
                 case 14:
-                    Module.ctxs[ctx_id].lineTo(args[0], args[1]);
+                    ctx.lineTo(HEAPF32[a], HEAPF32[a + 1]);
                     break;
                 case 15:
-                    Module.ctxs[ctx_id].quadraticCurveTo(args[0], args[1],
-                                                         args[2], args[3]);
+                    ctx.quadraticCurveTo(HEAPF32[a], HEAPF32[a + 1],
+                                         HEAPF32[a + 2], HEAPF32[a + 3]);
                     break;
                 case 16:
-                    Module.ctxs[ctx_id].bezierCurveTo(
-                        args[0], args[1], args[2], args[3], args[4], args[5]);
+                    ctx.bezierCurveTo(HEAPF32[a], HEAPF32[a + 1],
+                                      HEAPF32[a + 2], HEAPF32[a + 3],
+                                      HEAPF32[a + 4], HEAPF32[a + 5]);
                     break;
                 case 17:
-                    Module.ctxs[ctx_id].arc(args[0], args[1], args[2], args[3],
-                                            args[4], args[5]);
+                    ctx.arc(HEAPF32[a], HEAPF32[a + 1], HEAPF32[a + 2],
+                            HEAPF32[a + 3], HEAPF32[a + 4], HEAPU32[a + 5]);
                     break;
                 case 18:
-                    Module.ctxs[ctx_id].ellipse(args[0], args[1], args[2],
-                                                args[3], 0, 6.283185307179586,
-                                                0);
+                    ctx.ellipse(HEAPF32[a], HEAPF32[a + 1], HEAPF32[a + 2],
+                                HEAPF32[a + 3], 0, 6.283185307179586, 0);
                     break;
                 case 19:
-                    Module.ctxs[ctx_id].rect(args[0], args[1], args[2],
-                                             args[3]);
+                    ctx.rect(HEAPF32[a], HEAPF32[a + 1], HEAPF32[a + 2],
+                             HEAPF32[a + 3]);
                     break;
                 case 20:
-                    Module.ctxs[ctx_id].drawImage(
-                        Module.ctxs[ctx_id_2].canvas, args[0], args[1], args[2],
-                        args[3], args[4], args[5], args[2], args[3]);
+                    ctx.drawImage(Module.ctxs[HEAPU32[a]].canvas,
+                                  HEAPF32[a + 1], HEAPF32[a + 2],
+                                  HEAPF32[a + 3], HEAPF32[a + 4],
+                                  HEAPF32[a + 5], HEAPF32[a + 6],
+                                  HEAPF32[a + 3], HEAPF32[a + 4]);
                     break;
                 case 21:
-                    Module.ctxs[ctx_id].fillRect(args[0], args[1], args[2],
-                                                 args[3]);
+                    ctx.fillRect(HEAPF32[a], HEAPF32[a + 1], HEAPF32[a + 2],
+                                 HEAPF32[a + 3]);
                     break;
                 case 22:
-                    Module.ctxs[ctx_id].strokeRect(args[0], args[1], args[2],
-                                                   args[3]);
+                    ctx.strokeRect(HEAPF32[a], HEAPF32[a + 1],
+                                   HEAPF32[a + 2], HEAPF32[a + 3]);
                     break;
                 case 23:
-                    Module.ctxs[ctx_id].fill();
+                    ctx.fill();
                     break;
                 case 24:
-                    Module.ctxs[ctx_id].stroke();
+                    ctx.stroke();
                     break;
                 case 25:
-                    Module.ctxs[ctx_id].clip();
+                    ctx.clip();
                     break;
                 case 26:
-                    Module.ctxs[ctx_id].clip("evenodd");
+                    ctx.clip("evenodd");
                     break;
                 case 27:
-                    str = UTF8ToString(char_arg);
-                    Module.ctxs[ctx_id].fillText(str, args[0], args[1]);
-                    _free(char_arg);
+                    str = UTF8ToString(HEAPU32[a + 2]);
+                    ctx.fillText(str, HEAPF32[a], HEAPF32[a + 1]);
+                    _free(HEAPU32[a + 2]);
                     break;
                 case 28:
-                    str = UTF8ToString(char_arg);
-                    Module.ctxs[ctx_id].strokeText(str, args[0], args[1]);
-                    _free(char_arg);
+                    str = UTF8ToString(HEAPU32[a + 2]);
+                    ctx.strokeText(str, HEAPF32[a], HEAPF32[a + 1]);
+                    _free(HEAPU32[a + 2]);
                     break;
                 default:
                     break;
                 }
-                instr += $2;
             }
+            return performance.now() - start;
         },
-        &instruction_tape[0], instruction_size, sizeof(struct renderer_args));
+        instruction_tape, tape_size);
+    tape_size = 0;
     instruction_size = 0;
 }
 
 uint32_t rr_renderer_get_op_size()
 {
-    return instruction_size + rollovers * INSTRUCTION_QUEUE_MAX_SIZE;
+    return frame_stats.instructions + instruction_size;
+}
+
+void rr_renderer_get_tape_stats(struct rr_renderer_tape_stats *stats)
+{
+    *stats = last_frame_stats;
+}
+
+uint32_t rr_renderer_tape_mark() { return tape_size; }
+
+uint64_t rr_renderer_tape_hash(uint32_t mark, uint32_t context_id)
+{
+    // fnv-1a over the records, text by content rather than by pointer
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (uint32_t at = mark; at < tape_size;)
+    {
+        uint32_t header = instruction_tape[at].u;
+        uint32_t op = header & 255;
+        uint32_t words = header >> 24;
+        if ((header >> 8 & 0xffff) != context_id)
+            return 0;
+        uint32_t hashed = op == 27 || op == 28 ? 3 : words + 1;
+        for (uint32_t i = 0; i < hashed; ++i)
+            hash = (hash ^ instruction_tape[at + i].u) * 0x100000001b3ull;
+        if (op == 27 || op == 28)
+        {
+            char const *text =
+                (char const *)(uintptr_t)instruction_tape[at + 3].u;
+            for (; *text; ++text)
+                hash = (hash ^ (uint8_t)*text) * 0x100000001b3ull;
+        }
+        at += words + 1;
+    }
+    return hash == 0 ? 1 : hash;
 }
 
-void rr_renderer_reset_instruction_queue() { instruction_size = rollovers = 0; }
\ No newline at end of file
+void rr_renderer_tape_rewind(uint32_t mark)
+{
+    for (uint32_t at = mark; at < tape_size;)
+    {
+        uint32_t header = instruction_tape[at].u;
+        if ((header & 255) == 27 || (header & 255) == 28)
+            free((void *)(uintptr_t)instruction_tape[at + 3].u);
+        at += (header >> 24) + 1;
+        --instruction_size;
+    }
+    tape_size = mark;
+}
+
+void rr_renderer_reset_instruction_queue()
+{
+    last_frame_stats = frame_stats;
+    memset(&frame_stats, 0, sizeof frame_stats);
+}
@@ -29,7 +29,22 @@
 
 void rr_simulation_init(struct rr_simulation *this)
 {
+    // pages are zeroed and kept instead of freed, the ui fading out after
+    // leaving a game still reads game->player_info out of them
+    rr_simulation_clear_pages(this);
+#define XX(COMPONENT, ID)                                                      \
+    struct rr_component_##COMPONENT                                            \
+        *COMPONENT##_pages[RR_COMPONENT_PAGE_COUNT];                           \
+    memcpy(COMPONENT##_pages, this->COMPONENT##_pages,                         \
+           sizeof COMPONENT##_pages);
+    RR_FOR_EACH_COMPONENT;
+#undef XX
     memset(this, 0, sizeof *this);
+#define XX(COMPONENT, ID)                                                      \
+    memcpy(this->COMPONENT##_pages, COMPONENT##_pages,                         \
+           sizeof COMPONENT##_pages);
+    RR_FOR_EACH_COMPONENT;
+#undef XX
 }
 
 void rr_simulation_entity_create_with_id(struct rr_simulation *this,
@@ -84,6 +99,10 @@ void rr_simulation_read_binary(struct rr_game *game, struct proto_bug *encoder)
     }
 
     // assuming that player info is written first (is it though)
+    // the readers stop at the end of the packet. a valid packet always has
+    // its trailer left after a record, so running out of bytes there means
+    // it was truncated
+    uint8_t truncated = 0;
     while (1)
     {
         id = proto_bug_read_varuint(encoder, "entity update id");
@@ -99,10 +118,17 @@ void rr_simulation_read_binary(struct rr_game *game, struct proto_bug *encoder)
             printf("create entity with id %d, components %d\n", id,
                    component_flags);
 #endif
+            // vectors get rebuilt in rr_simulation_tick so the components
+            // are initialized in place instead of going through add
             this->entity_tracker[id] = 1 | component_flags;
 #define XX(COMPONENT, ID)                                                      \
     if (component_flags & (1 << ID))                                           \
-        rr_simulation_add_##COMPONENT(this, id);
+    {                                                                          \
+        struct rr_component_##COMPONENT *c =                                   \
+            rr_simulation_reserve_##COMPONENT(this, id);                       \
+        rr_component_##COMPONENT##_init(c, this);                              \
+        c->parent_id = id;                                                     \
+    }
             RR_FOR_EACH_COMPONENT
 #undef XX
         }
@@ -114,13 +140,24 @@ void rr_simulation_read_binary(struct rr_game *game, struct proto_bug *encoder)
 #define XX(COMPONENT, ID)                                                      \
     if (component_flags & (1 << ID))                                           \
         rr_component_##COMPONENT##_read(                                       \
-            rr_simulation_get_##COMPONENT(this, id), encoder);
+            RR_SIMULATION_COMPONENT(this, COMPONENT, id), encoder);
         RR_FOR_EACH_COMPONENT
 #undef XX
+        if (encoder->current >= encoder->end)
+        {
+            printf("protocol error: packet truncated at entity %d\n", id);
+            truncated = 1;
+            break;
+        }
+    }
+    // the trailer is gone with a truncated packet, the last player info is
+    // kept since its page stays allocated
+    if (!truncated)
+    {
+        game->player_info = rr_simulation_get_player_info(
+            this, proto_bug_read_varuint(encoder, "pinfo id"));
+        this->game_over = proto_bug_read_uint8(encoder, "game over");
     }
-    game->player_info = rr_simulation_get_player_info(
-        this, proto_bug_read_varuint(encoder, "pinfo id"));
-    this->game_over = proto_bug_read_uint8(encoder, "game over");
     this->updated_this_tick = 1;
 }
 
@@ -19,135 +19,146 @@
 
 #include <Shared/Entity.h>
 #include <Shared/SimulationCommon.h>
+#include <Shared/Utilities.h>
 #include <Shared/Vector.h>
 
-struct function_captures
+// shortest way around from start to end, with no fmod. the result isn't
+// wrapped into a fixed range but stays within pi of end
+static float angle_lerp(float start, float end, float t)
 {
-    float delta;
-    struct rr_simulation *simulation;
-};
+    float difference = end - start;
+    difference -= 2 * M_PI * floorf(difference * (0.5f / M_PI) + 0.5f);
+    return difference * t + start;
+}
 
-void system_interpolation_for_each_function(EntityIdx entity, void *_captures)
+// every factor is clamped once per frame instead of once per field. mobs
+// used to get their radius and angle lerped twice, so they still step
+// by 1 - (1 - t)^2
+static void interpolate_physicals(struct rr_simulation *this, float delta)
 {
-    struct function_captures *captures = _captures;
-    struct rr_simulation *this = captures->simulation;
-    float delta = captures->delta;
-    if (rr_simulation_has_physical(this, entity))
+    float position_t = rr_fclamp(10 * delta, 0, 1);
+    float velocity_t = rr_fclamp(5 * delta, 0, 1);
+    float mob_t = 1 - (1 - position_t) * (1 - position_t);
+    float turning_t = rr_fclamp(6 * delta, 0, 1);
+    for (EntityIdx i = 0; i < this->physical_count; ++i)
     {
+        EntityIdx entity = this->physical_vector[i];
         struct rr_component_physical *physical =
-            rr_simulation_get_physical(this, entity);
+            RR_SIMULATION_COMPONENT(this, physical, entity);
         if (physical->lerp_x == 0)
             physical->lerp_x = physical->x;
         if (physical->lerp_y == 0)
             physical->lerp_y = physical->y;
-
-        physical->velocity.x = physical->x - physical->lerp_x;
-        physical->velocity.y = physical->y - physical->lerp_y;
-
-        physical->lerp_x = rr_lerp(physical->lerp_x, physical->x, 10 * delta);
-        physical->lerp_y = rr_lerp(physical->lerp_y, physical->y, 10 * delta);
-        physical->lerp_velocity.x =
-            rr_lerp(physical->lerp_velocity.x, physical->velocity.x, 5 * delta);
-        physical->lerp_velocity.y =
-            rr_lerp(physical->lerp_velocity.y, physical->velocity.y, 5 * delta);
         if (physical->lerp_angle == 0)
             physical->lerp_angle = physical->angle;
 
-        physical->lerp_radius =
-            rr_lerp(physical->lerp_radius, physical->radius, 10 * delta);
-        physical->lerp_angle =
-            rr_angle_lerp(physical->lerp_angle, physical->angle, 10 * delta);
-        if (rr_simulation_has_mob(this, entity))
+        physical->velocity.x = physical->x - physical->lerp_x;
+        physical->velocity.y = physical->y - physical->lerp_y;
+        physical->lerp_x += physical->velocity.x * position_t;
+        physical->lerp_y += physical->velocity.y * position_t;
+        physical->lerp_velocity.x +=
+            (physical->velocity.x - physical->lerp_velocity.x) * velocity_t;
+        physical->lerp_velocity.y +=
+            (physical->velocity.y - physical->lerp_velocity.y) * velocity_t;
+
+        if (!rr_simulation_has_mob(this, entity))
         {
-            if (physical->turning_animation == 0)
-                physical->turning_animation = physical->angle;
-
-            physical->lerp_radius =
-                rr_lerp(physical->lerp_radius, physical->radius, 10 * delta);
-            physical->lerp_angle = rr_angle_lerp(physical->lerp_angle,
-                                                 physical->angle, 10 * delta);
-            physical->turning_animation = rr_angle_lerp(
-                physical->turning_animation, physical->angle, 6 * delta);
-
-            physical->animation_timer +=
-                (2 * (physical->parent_id % 2) - 1) * delta *
-                (fmin(rr_vector_get_magnitude(&physical->lerp_velocity), 20) *
-                     0.5 +
-                 1) *
-                2;
-        }
-        else
+            physical->lerp_radius +=
+                (physical->radius - physical->lerp_radius) * position_t;
+            physical->lerp_angle =
+                angle_lerp(physical->lerp_angle, physical->angle, position_t);
             physical->animation_timer += 0.5;
+            continue;
+        }
+        if (physical->turning_animation == 0)
+            physical->turning_animation = physical->angle;
+        physical->lerp_radius +=
+            (physical->radius - physical->lerp_radius) * mob_t;
+        physical->lerp_angle =
+            angle_lerp(physical->lerp_angle, physical->angle, mob_t);
+        physical->turning_animation = angle_lerp(
+            physical->turning_animation, physical->angle, turning_t);
+        float speed = rr_vector_get_magnitude(&physical->lerp_velocity);
+        if (speed > 20)
+            speed = 20;
+        physical->animation_timer +=
+            (2 * (physical->parent_id % 2) - 1) * delta * (speed * 0.5 + 1) * 2;
     }
+}
 
-    if (rr_simulation_has_flower(this, entity))
+static void interpolate_flowers(struct rr_simulation *this, float delta)
+{
+    float t = rr_fclamp(20 * delta, 0, 1);
+    for (EntityIdx i = 0; i < this->flower_count; ++i)
     {
+        EntityIdx entity = this->flower_vector[i];
         struct rr_component_flower *flower =
-            rr_simulation_get_flower(this, entity);
-        struct rr_component_physical *physical =
-            rr_simulation_get_physical(this, entity);
-        flower->eye_x = cosf(flower->eye_angle - physical->angle) * 3;
-        flower->eye_y = sinf(flower->eye_angle - physical->angle) * 3;
+            RR_SIMULATION_COMPONENT(this, flower, entity);
+        float angle = flower->eye_angle -
+                      RR_SIMULATION_COMPONENT(this, physical, entity)->angle;
+        flower->eye_x = cosf(angle) * 3;
+        flower->eye_y = sinf(angle) * 3;
         if (flower->lerp_eye_x == 0)
             flower->lerp_eye_x = flower->eye_x;
         if (flower->lerp_eye_y == 0)
             flower->lerp_eye_y = flower->eye_y;
         if (flower->lerp_mouth == 0)
             flower->lerp_mouth = 15;
-        flower->lerp_eye_x =
-            rr_lerp(flower->lerp_eye_x, flower->eye_x, 20 * delta);
-        flower->lerp_eye_y =
-            rr_lerp(flower->lerp_eye_y, flower->eye_y, 20 * delta);
-        if (flower->face_flags & 1)
-            flower->lerp_mouth = rr_lerp(flower->lerp_mouth, 5, 20 * delta);
-        else if (flower->face_flags & 2)
-            flower->lerp_mouth = rr_lerp(flower->lerp_mouth, 8, 20 * delta);
-        else
-            flower->lerp_mouth = rr_lerp(flower->lerp_mouth, 15, 20 * delta);
+        flower->lerp_eye_x += (flower->eye_x - flower->lerp_eye_x) * t;
+        flower->lerp_eye_y += (flower->eye_y - flower->lerp_eye_y) * t;
+        float mouth = flower->face_flags & 1   ? 5
+                      : flower->face_flags & 2 ? 8
+                                               : 15;
+        flower->lerp_mouth += (mouth - flower->lerp_mouth) * t;
     }
+}
 
-    if (rr_simulation_has_player_info(this, entity))
+static void interpolate_player_infos(struct rr_simulation *this, float delta)
+{
+    float fov_t = rr_fclamp(15 * delta, 0, 1);
+    float t = rr_fclamp(10 * delta, 0, 1);
+    for (EntityIdx i = 0; i < this->player_info_count; ++i)
     {
         struct rr_component_player_info *player_info =
-            rr_simulation_get_player_info(this, entity);
+            RR_SIMULATION_COMPONENT(this, player_info,
+                                    this->player_info_vector[i]);
         if (player_info->lerp_camera_fov == 0)
             player_info->lerp_camera_fov = player_info->camera_fov;
         if (player_info->lerp_camera_x == 0)
             player_info->lerp_camera_x = player_info->camera_x;
         if (player_info->lerp_camera_y == 0)
             player_info->lerp_camera_y = player_info->camera_y;
-        player_info->lerp_camera_fov = rr_lerp(
-            player_info->lerp_camera_fov, player_info->camera_fov, 15 * delta);
-        player_info->lerp_camera_x = rr_lerp(player_info->lerp_camera_x,
-                                             player_info->camera_x, 10 * delta);
-        player_info->lerp_camera_y = rr_lerp(player_info->lerp_camera_y,
-                                             player_info->camera_y, 10 * delta);
+        player_info->lerp_camera_fov +=
+            (player_info->camera_fov - player_info->lerp_camera_fov) * fov_t;
+        player_info->lerp_camera_x +=
+            (player_info->camera_x - player_info->lerp_camera_x) * t;
+        player_info->lerp_camera_y +=
+            (player_info->camera_y - player_info->lerp_camera_y) * t;
     }
+}
 
-    if (rr_simulation_has_health(this, entity))
+static void interpolate_healths(struct rr_simulation *this, float delta)
+{
+    float damage_t = rr_fclamp(5 * delta, 0, 1);
+    float t = rr_fclamp(25 * delta, 0, 1);
+    for (EntityIdx i = 0; i < this->health_count; ++i)
     {
         struct rr_component_health *health =
-            rr_simulation_get_health(this, entity);
-        health->damage_animation =
-            rr_lerp(health->damage_animation, 0, 5 * delta);
-        if (health->flags & 2)
-        {
-            if (health->damage_animation < 0.25)
-                health->damage_animation = 1;
-        }
+            RR_SIMULATION_COMPONENT(this, health, this->health_vector[i]);
+        health->damage_animation -= health->damage_animation * damage_t;
+        if (health->flags & 2 && health->damage_animation < 0.25)
+            health->damage_animation = 1;
         if (health->lerp_health == 0)
             health->lerp_health = health->health;
-        health->lerp_health =
-            rr_lerp(health->lerp_health, health->health, 25 * delta);
+        health->lerp_health += (health->health - health->lerp_health) * t;
     }
 }
 
 void rr_system_interpolation_tick(struct rr_simulation *simulation, float delta)
 {
-    struct function_captures captures;
-    captures.simulation = simulation;
-    captures.delta = delta;
-    rr_simulation_for_each_entity(simulation, &captures,
-                                  system_interpolation_for_each_function);
+    interpolate_physicals(simulation, delta);
+    interpolate_flowers(simulation, delta);
+    interpolate_player_infos(simulation, delta);
+    interpolate_healths(simulation, delta);
     simulation->updated_this_tick = 0;
 }
@@ -19,6 +19,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <Client/Assets/RenderFunctions.h>
 #include <Client/Game.h>
 #include <Client/InputData.h>
 #include <Client/Renderer/Renderer.h>
@@ -43,7 +44,7 @@ static void labeled_button_on_render(struct rr_ui_element *this,
         rr_renderer_add_color_filter(renderer, 0xff000000, 0.2);
 
     this->abs_width =
-        15 + rr_renderer_get_text_size(data->text) * this->abs_height / 2;
+        15 + rr_renderer_measure_text(data->text) * this->abs_height / 2;
     if (this->abs_width < this->abs_height)
         this->abs_width = this->abs_height;
     rr_renderer_scale(renderer, renderer->scale);
@@ -60,16 +61,9 @@ static void labeled_button_on_render(struct rr_ui_element *this,
         rr_renderer_set_stroke(renderer, this->fill);
         rr_renderer_stroke(renderer);
     }
-    rr_renderer_set_text_baseline(renderer, 1);
-    rr_renderer_set_text_align(renderer, 1);
     renderer->state.filter.amount = 0;
-    rr_renderer_set_fill(renderer, 0xffffffff);
-    rr_renderer_set_stroke(renderer, 0xff222222);
-    rr_renderer_set_text_size(renderer, this->abs_height / 2);
-    rr_renderer_set_line_width(renderer, this->abs_height / 2 * 0.12);
-    rr_renderer_begin_path(renderer);
-    rr_renderer_stroke_text(renderer, data->text, 0, 0);
-    rr_renderer_fill_text(renderer, data->text, 0, 0);
+    rr_renderer_draw_text(renderer, data->text, 0, 0, this->abs_height / 2,
+                          0xffffffff, 1, 1);
 }
 
 struct rr_ui_element *rr_ui_labeled_button_init(char *text, float height,
@@ -82,7 +76,7 @@ struct rr_ui_element *rr_ui_labeled_button_init(char *text, float height,
     this->data = data;
     this->abs_height = this->height = height;
     this->abs_width = this->width =
-        15 + rr_renderer_get_text_size(text) * height / 2;
+        15 + rr_renderer_measure_text(text) * height / 2;
     this->on_render = labeled_button_on_render;
     this->on_event = button_on_event;
     rr_ui_set_background(this, 0xff000000);
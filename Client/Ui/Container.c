@@ -114,6 +114,7 @@ struct rr_ui_element *rr_ui_container_add_element(struct rr_ui_element *this,
     }
     this->elements.start[this->elements.size++] = add;
     add->container = this;
+    this->layout_dirty = 1;
     return add;
 }
 
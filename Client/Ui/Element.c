@@ -63,6 +63,87 @@ void rr_ui_instant_hide_animate(struct rr_ui_element *this,
         this->animation = 1;
 }
 
+struct rr_ui_layer
+{
+    struct rr_renderer renderer;
+    uint64_t hash;
+    uint16_t misses;
+    uint16_t cooldown;
+};
+
+// a layer that misses this many frames in a row is animating, so it's
+// drawn directly for a while instead of paying for the blit on top
+#define LAYER_MAX_MISSES (8)
+#define LAYER_COOLDOWN (120)
+// room for strokes and shadows that spill past abs_width
+#define LAYER_PADDING (24)
+
+static uint8_t in_layer = 0;
+
+// records the subtree into the layer's canvas and throws the recording away
+// again when it hashes the same as what the canvas already holds. on_render
+// still runs every frame so hover checks and the like keep working
+static void render_layer(struct rr_ui_element *this, struct rr_game *game)
+{
+    struct rr_ui_layer *layer = this->layer;
+    struct rr_renderer *renderer = game->renderer;
+    if (in_layer || layer->cooldown > 0)
+    {
+        if (layer->cooldown > 0)
+            --layer->cooldown;
+        this->on_render(this, game);
+        return;
+    }
+    float padding = LAYER_PADDING * renderer->scale;
+    float width = ceilf(this->abs_width * renderer->scale + 2 * padding);
+    float height = ceilf(this->abs_height * renderer->scale + 2 * padding);
+    if (width != layer->renderer.width || height != layer->renderer.height)
+    {
+        rr_renderer_set_dimensions(&layer->renderer, width, height);
+        layer->hash = 0;
+    }
+    float origin_x = floorf(this->abs_x - width / 2);
+    float origin_y = floorf(this->abs_y - height / 2);
+    uint32_t context_id = renderer->context_id;
+    float global_alpha = renderer->state.global_alpha;
+
+    renderer->context_id = layer->renderer.context_id;
+    renderer->origin_x = origin_x;
+    renderer->origin_y = origin_y;
+    // the fade is applied once when the layer is drawn
+    renderer->state.global_alpha = 1;
+    renderer->matrix_moddified = 1;
+    uint32_t mark = rr_renderer_tape_mark();
+    in_layer = 1;
+    this->on_render(this, game);
+    in_layer = 0;
+    uint64_t hash = rr_renderer_tape_hash(mark, layer->renderer.context_id);
+    renderer->context_id = context_id;
+    renderer->origin_x = renderer->origin_y = 0;
+    renderer->state.global_alpha = global_alpha;
+    renderer->matrix_moddified = 1;
+
+    if (hash != 0 && hash == layer->hash)
+    {
+        rr_renderer_tape_rewind(mark);
+        layer->misses = 0;
+    }
+    else
+    {
+        // also resets whatever clip or transform was left on the canvas
+        rr_renderer_set_dimensions(&layer->renderer, width, height);
+        layer->hash = hash;
+        if (++layer->misses == LAYER_MAX_MISSES)
+        {
+            layer->misses = 0;
+            layer->cooldown = LAYER_COOLDOWN;
+        }
+    }
+    rr_renderer_set_transform(renderer, 1, 0, origin_x + width / 2, 0, 1,
+                              origin_y + height / 2);
+    rr_renderer_draw_image(renderer, &layer->renderer);
+}
+
 void rr_ui_render_element(struct rr_ui_element *this, struct rr_game *game)
 {
     struct rr_renderer_context_state state;
@@ -100,7 +181,12 @@ void rr_ui_render_element(struct rr_ui_element *this, struct rr_game *game)
 
     this->animate(this, game);
     if (this->completely_hidden == 0)
-        this->on_render(this, game);
+    {
+        if (this->layer != NULL)
+            render_layer(this, game);
+        else
+            this->on_render(this, game);
+    }
     this->first_frame = 0;
     rr_renderer_context_state_free(game->renderer, &state);
 }
@@ -202,6 +288,7 @@ struct rr_ui_element *rr_ui_element_init()
     this->poll_events = rr_ui_element_check_if_focused;
     this->animate = rr_ui_default_animate;
     this->resizeable = rr_ui_not_resizeable;
+    this->layout_dirty = 1;
     this->elements.size = 0;
     this->elements.capacity = 1;
     this->elements.start =
@@ -223,3 +310,14 @@ struct rr_ui_element *rr_ui_link_toggle(
     this->should_show = should_show;
     return this;
 }
+
+// for panels that look the same most frames. they are drawn from an
+// offscreen canvas that is only redrawn when their output changes
+struct rr_ui_element *rr_ui_cache_layer(struct rr_ui_element *this)
+{
+    struct rr_ui_layer *layer = malloc(sizeof *layer);
+    memset(layer, 0, sizeof *layer);
+    rr_renderer_init(&layer->renderer);
+    this->layer = layer;
+    return this;
+}
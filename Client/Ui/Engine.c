@@ -295,10 +295,29 @@ static void rr_ui_scroll_container_set(struct rr_ui_element *c)
     c->abs_width = c->width = w + 10;
 }
 
+// the size a parent lays a child out by, also remembered for next time
+static uint8_t layout_changed(struct rr_ui_element *this)
+{
+    uint8_t changed = this->laid_out_width != this->width ||
+                      this->laid_out_height != this->height ||
+                      this->laid_out_abs_width != this->abs_width ||
+                      this->laid_out_abs_height != this->abs_height ||
+                      this->laid_out_hidden != this->completely_hidden;
+    this->laid_out_width = this->width;
+    this->laid_out_height = this->height;
+    this->laid_out_abs_width = this->abs_width;
+    this->laid_out_abs_height = this->abs_height;
+    this->laid_out_hidden = this->completely_hidden;
+    return changed;
+}
+
 void rr_ui_container_refactor(struct rr_ui_element *c, struct rr_game *game)
 {
     if (c->elements.size != 0)
     {
+        // containers are only laid out again when a child changed size or
+        // visibility, otherwise the positions from last time still hold
+        uint8_t dirty = c->layout_dirty;
         for (uint64_t i = 0; i < c->elements.size; ++i)
         {
             struct rr_ui_element *element = c->elements.start[i];
@@ -310,11 +329,12 @@ void rr_ui_container_refactor(struct rr_ui_element *c, struct rr_game *game)
             element->completely_hidden = element->animation > 0.99;
             if (element->completely_hidden && before_hidden == 0)
                 element->on_hide(element, game);
-            if (element->completely_hidden)
-                continue;
-            rr_ui_container_refactor(element, game);
+            if (!element->completely_hidden)
+                rr_ui_container_refactor(element, game);
+            dirty |= layout_changed(element);
         }
-        if (c->resizeable)
+        c->layout_dirty = 0;
+        if (c->resizeable && dirty)
         {
             if (c->resizeable == rr_ui_h_container)
                 rr_ui_h_container_set(c);
@@ -69,19 +69,11 @@ static void collected_button_on_render(struct rr_ui_element *this,
         return;
     rr_renderer_translate(renderer, 25, -25);
     rr_renderer_rotate(renderer, 0.5);
-    rr_renderer_set_fill(renderer, 0xffffffff);
-    rr_renderer_set_stroke(renderer, 0xff222222);
-    rr_renderer_set_text_align(renderer, 1);
-    rr_renderer_set_text_baseline(renderer, 1);
-    rr_renderer_set_text_size(renderer, 18);
-    rr_renderer_set_line_width(renderer, 18 * 0.12);
-
     char out[12];
     sprintf(&out[0], "x%d",
             game->player_info->collected_this_run[data->id * rr_rarity_id_max +
                                                   data->rarity]);
-    rr_renderer_stroke_text(renderer, (char const *)&out, 0, 0);
-    rr_renderer_fill_text(renderer, (char const *)&out, 0, 0);
+    rr_renderer_draw_text(renderer, out, 0, 0, 18, 0xffffffff, 1, 1);
 }
 
 static struct rr_ui_element *collected_button_init(uint8_t id, uint8_t rarity)
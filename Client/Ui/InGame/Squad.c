@@ -17,6 +17,7 @@
 
 #include <stdlib.h>
 
+#include <Client/Assets/RenderFunctions.h>
 #include <Client/Game.h>
 #include <Client/Renderer/ComponentRender.h>
 #include <Client/Renderer/Renderer.h>
@@ -174,19 +175,10 @@ static void player_hud_on_render(struct rr_ui_element *this,
         }
     }
     rr_renderer_context_state_free(renderer, &state);
-    rr_renderer_set_text_baseline(renderer, 1);
-    rr_renderer_set_text_align(renderer, 0);
-    rr_renderer_set_fill(renderer, 0xffffffff);
-    rr_renderer_set_stroke(renderer, 0xff222222);
-    rr_renderer_set_text_size(renderer, 18);
-    rr_renderer_set_line_width(renderer, 18 * 0.12);
     rr_renderer_translate(renderer, -this->abs_width / 2, 0);
-    rr_renderer_stroke_text(
-        renderer, game->squad.squad_members[player_info->squad_pos].nickname,
-        45, 0);
-    rr_renderer_fill_text(
+    rr_renderer_draw_text(
         renderer, game->squad.squad_members[player_info->squad_pos].nickname,
-        45, 0);
+        45, 0, 18, 0xffffffff, 0, 1);
 }
 
 struct rr_ui_element *rr_ui_in_game_player_hud_init(uint8_t pos)
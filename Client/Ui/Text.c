@@ -19,6 +19,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <Client/Assets/RenderFunctions.h>
 #include <Client/Game.h>
 #include <Client/Renderer/Renderer.h>
 #include <Client/Ui/Engine.h>
@@ -31,15 +32,9 @@ static void text_on_render(struct rr_ui_element *this, struct rr_game *game)
     struct rr_renderer *renderer = game->renderer;
     rr_renderer_scale(renderer, renderer->scale);
     this->abs_width = this->width =
-        rr_renderer_get_text_size(data->text) * this->height;
-    rr_renderer_set_text_baseline(renderer, 1);
-    rr_renderer_set_text_align(renderer, 1);
-    rr_renderer_set_fill(renderer, this->fill);
-    rr_renderer_set_stroke(renderer, 0xff222222);
-    rr_renderer_set_text_size(renderer, data->size);
-    rr_renderer_set_line_width(renderer, data->size * 0.12);
-    rr_renderer_stroke_text(renderer, data->text, 0, 0);
-    rr_renderer_fill_text(renderer, data->text, 0, 0);
+        rr_renderer_measure_text(data->text) * this->height;
+    rr_renderer_draw_text(renderer, data->text, 0, 0, data->size, this->fill,
+                          1, 1);
 }
 
 static void dynamic_text_on_render(struct rr_ui_element *this,
@@ -50,15 +45,9 @@ static void dynamic_text_on_render(struct rr_ui_element *this,
     struct rr_renderer *renderer = game->renderer;
     rr_renderer_scale(renderer, renderer->scale);
     this->abs_width = this->width =
-        rr_renderer_get_text_size(data->text) * this->height;
-    rr_renderer_set_text_baseline(renderer, 1);
-    rr_renderer_set_text_align(renderer, 1);
-    rr_renderer_set_fill(renderer, this->fill);
-    rr_renderer_set_stroke(renderer, 0xff222222);
-    rr_renderer_set_text_size(renderer, data->size);
-    rr_renderer_set_line_width(renderer, data->size * 0.12);
-    rr_renderer_stroke_text(renderer, data->text, 0, 0);
-    rr_renderer_fill_text(renderer, data->text, 0, 0);
+        rr_renderer_measure_text(data->text) * this->height;
+    rr_renderer_draw_text(renderer, data->text, 0, 0, data->size, this->fill,
+                          1, 1);
 }
 
 struct rr_ui_element *rr_ui_text_init(char const *text, float size,
@@ -66,7 +55,7 @@ struct rr_ui_element *rr_ui_text_init(char const *text, float size,
 {
     struct rr_ui_element *this = rr_ui_element_init();
     struct rr_ui_text_metadata *data = malloc(sizeof *data);
-    this->abs_width = this->width = rr_renderer_get_text_size(text) * size;
+    this->abs_width = this->width = rr_renderer_measure_text(text) * size;
     rr_ui_set_background(this, fill);
     this->abs_height = this->height = data->size = size;
     data->text = text;
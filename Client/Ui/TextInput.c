@@ -15,7 +15,9 @@
 
 #include <Client/Ui/Ui.h>
 
+#ifdef EMSCRIPTEN
 #include <emscripten.h>
+#endif
 #include <stdlib.h>
 #include <string.h>
 
@@ -41,7 +43,6 @@ static void text_input_on_hide(struct rr_ui_element *this, struct rr_game *game)
 static void text_input_on_render(struct rr_ui_element *this,
                                  struct rr_game *game)
 {
-    struct rr_renderer_context_state state;
     struct text_input_metadata *data = this->data;
     struct rr_renderer *renderer = game->renderer;
     rr_dom_element_show(data->name);
@@ -63,6 +64,7 @@ static void text_input_on_render(struct rr_ui_element *this,
         rr_renderer_stroke_rect(renderer, -this->width / 2, -this->height / 2,
                                 this->width, this->height);
     }
+#ifdef EMSCRIPTEN
     if (game->is_mobile)
     {
         if (rr_ui_mouse_over(this, game) &&
@@ -76,6 +78,7 @@ static void text_input_on_render(struct rr_ui_element *this,
                 data->name);
         }
     }
+#endif
     return;
 }
 
@@ -19,6 +19,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <Client/Assets/RenderFunctions.h>
 #include <Client/Game.h>
 #include <Client/InputData.h>
 #include <Client/Renderer/Renderer.h>
@@ -53,7 +54,7 @@ static void biome_button_on_render(struct rr_ui_element *this,
         renderer->state.filter.amount = 0.4;
 
     this->abs_width =
-        10 + rr_renderer_get_text_size(data->text) * this->abs_height / 2;
+        10 + rr_renderer_measure_text(data->text) * this->abs_height / 2;
     if (this->abs_width < this->abs_height)
         this->abs_width = this->abs_height;
     rr_renderer_scale(renderer, renderer->scale);
@@ -67,16 +68,9 @@ static void biome_button_on_render(struct rr_ui_element *this,
                            this->abs_height, 6);
     rr_renderer_fill(renderer);
     rr_renderer_stroke(renderer);
-    rr_renderer_set_text_baseline(renderer, 1);
-    rr_renderer_set_text_align(renderer, 1);
     renderer->state.filter.amount = 0;
-    rr_renderer_set_fill(renderer, 0xffffffff);
-    rr_renderer_set_stroke(renderer, 0xff222222);
-    rr_renderer_set_text_size(renderer, this->abs_height / 2);
-    rr_renderer_set_line_width(renderer, this->abs_height / 2 * 0.12);
-    rr_renderer_begin_path(renderer);
-    rr_renderer_stroke_text(renderer, data->text, 0, 0);
-    rr_renderer_fill_text(renderer, data->text, 0, 0);
+    rr_renderer_draw_text(renderer, data->text, 0, 0, this->abs_height / 2,
+                          0xffffffff, 1, 1);
 }
 
 struct rr_ui_element *rr_ui_biome_button_init(char *text, uint32_t fill,
@@ -90,7 +84,7 @@ struct rr_ui_element *rr_ui_biome_button_init(char *text, uint32_t fill,
     this->data = data;
     this->abs_height = this->height = height;
     this->abs_width = this->width =
-        10 + rr_renderer_get_text_size(text) * height / 2;
+        10 + rr_renderer_measure_text(text) * height / 2;
     this->on_render = biome_button_on_render;
     this->on_event = biome_button_on_event;
     rr_ui_set_background(this, fill);
@@ -176,17 +176,9 @@ static void crafting_ring_petal_on_render(struct rr_ui_element *this,
         return;
     rr_renderer_translate(renderer, 25, -25);
     rr_renderer_rotate(renderer, 0.5);
-    rr_renderer_set_fill(renderer, 0xffffffff);
-    rr_renderer_set_stroke(renderer, 0xff222222);
-    rr_renderer_set_text_align(renderer, 1);
-    rr_renderer_set_text_baseline(renderer, 1);
-    rr_renderer_set_text_size(renderer, 18);
-    rr_renderer_set_line_width(renderer, 18 * 0.12);
-
     char out[12];
     sprintf(&out[0], "x%d", data->count);
-    rr_renderer_stroke_text(renderer, (char const *)&out, 0, 0);
-    rr_renderer_fill_text(renderer, (char const *)&out, 0, 0);
+    rr_renderer_draw_text(renderer, out, 0, 0, 18, 0xffffffff, 1, 1);
 }
 
 static struct rr_ui_element *crafting_ring_petal_init(uint8_t pos)
@@ -268,17 +260,9 @@ static void crafting_result_container_on_render(struct rr_ui_element *this,
         return;
     rr_renderer_translate(renderer, 25, -25);
     rr_renderer_rotate(renderer, 0.5);
-    rr_renderer_set_fill(renderer, 0xffffffff);
-    rr_renderer_set_stroke(renderer, 0xff222222);
-    rr_renderer_set_text_align(renderer, 1);
-    rr_renderer_set_text_baseline(renderer, 1);
-    rr_renderer_set_text_size(renderer, 18);
-    rr_renderer_set_line_width(renderer, 18 * 0.12);
-
     char out[12];
     sprintf(&out[0], "x%d", game->crafting_data.success_count);
-    rr_renderer_stroke_text(renderer, (char const *)&out, 0, 0);
-    rr_renderer_fill_text(renderer, (char const *)&out, 0, 0);
+    rr_renderer_draw_text(renderer, out, 0, 0, 18, 0xffffffff, 1, 1);
 }
 
 static struct rr_ui_element *crafting_result_container_init()
@@ -460,17 +444,9 @@ static void crafting_inventory_button_on_render(struct rr_ui_element *this,
         return;
     rr_renderer_translate(renderer, 25, -25);
     rr_renderer_rotate(renderer, 0.5);
-    rr_renderer_set_fill(renderer, 0xffffffff);
-    rr_renderer_set_stroke(renderer, 0xff222222);
-    rr_renderer_set_text_align(renderer, 1);
-    rr_renderer_set_text_baseline(renderer, 1);
-    rr_renderer_set_text_size(renderer, 18);
-    rr_renderer_set_line_width(renderer, 18 * 0.12);
-
     char out[12];
     sprintf(&out[0], "x%d", data->count);
-    rr_renderer_stroke_text(renderer, (char const *)&out, 0, 0);
-    rr_renderer_fill_text(renderer, (char const *)&out, 0, 0);
+    rr_renderer_draw_text(renderer, out, 0, 0, 18, 0xffffffff, 1, 1);
 }
 
 struct rr_ui_element *crafting_inventory_button_init(uint8_t id, uint8_t rarity)
@@ -17,6 +17,7 @@
 
 #include <stdlib.h>
 
+#include <Client/Assets/RenderFunctions.h>
 #include <Client/Game.h>
 #include <Client/Renderer/Renderer.h>
 
@@ -86,17 +87,10 @@ void level_bar_on_render(struct rr_ui_element *this, struct rr_game *game)
                             (this->abs_width - this->abs_height) * ratio,
                         0);
     rr_renderer_stroke(renderer);
-    rr_renderer_set_stroke(renderer, 0xff222222);
-    rr_renderer_set_fill(renderer, 0xffffffff);
-    rr_renderer_set_text_size(renderer, this->abs_height * 0.5);
-    rr_renderer_set_text_align(renderer, 1);
-    rr_renderer_set_text_baseline(renderer, 1);
-    rr_renderer_set_line_width(renderer, this->abs_height * 0.5 * 0.12);
     char out[16];
     sprintf(out, "Level %d", data->level);
-    rr_renderer_begin_path(renderer);
-    rr_renderer_stroke_text(renderer, out, 0, 0);
-    rr_renderer_fill_text(renderer, out, 0, 0);
+    rr_renderer_draw_text(renderer, out, 0, 0, this->abs_height * 0.5,
+                          0xffffffff, 1, 1);
     // printf("%.0f %d\n", xp, next_level - 1);
 }
 
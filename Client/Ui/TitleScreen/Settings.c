@@ -19,6 +19,7 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <Client/Assets/RenderFunctions.h>
 #include <Client/Game.h>
 #include <Client/InputData.h>
 #include <Client/Renderer/Renderer.h>
@@ -54,16 +55,9 @@ static void region_button_on_render(struct rr_ui_element *this,
                            -this->abs_height / 2, this->abs_width,
                            this->abs_height, 6);
     rr_renderer_fill(renderer);
-    rr_renderer_set_text_baseline(renderer, 1);
-    rr_renderer_set_text_align(renderer, 1);
     renderer->state.filter.amount = 0;
-    rr_renderer_set_fill(renderer, 0xffffffff);
-    rr_renderer_set_stroke(renderer, 0xff222222);
-    rr_renderer_set_text_size(renderer, this->abs_height / 2);
-    rr_renderer_set_line_width(renderer, this->abs_height / 2 * 0.12);
-    rr_renderer_begin_path(renderer);
-    rr_renderer_stroke_text(renderer, regions[selected], 0, 0);
-    rr_renderer_fill_text(renderer, regions[selected], 0, 0);
+    rr_renderer_draw_text(renderer, regions[selected], 0, 0,
+                          this->abs_height / 2, 0xffffffff, 1, 1);
 }
 
 static struct rr_ui_element *region_toggle_button_init()
@@ -115,16 +109,9 @@ static void region_join_button_on_render(struct rr_ui_element *this,
                            -this->abs_height / 2, this->abs_width,
                            this->abs_height, 6);
     rr_renderer_fill(renderer);
-    rr_renderer_set_text_baseline(renderer, 1);
-    rr_renderer_set_text_align(renderer, 1);
     renderer->state.filter.amount = 0;
-    rr_renderer_set_fill(renderer, 0xffffffff);
-    rr_renderer_set_stroke(renderer, 0xff222222);
-    rr_renderer_set_text_size(renderer, this->abs_height / 2);
-    rr_renderer_set_line_width(renderer, this->abs_height / 2 * 0.12);
-    rr_renderer_begin_path(renderer);
-    rr_renderer_stroke_text(renderer, "Join", 0, 0);
-    rr_renderer_fill_text(renderer, "Join", 0, 0);
+    rr_renderer_draw_text(renderer, "Join", 0, 0, this->abs_height / 2,
+                          0xffffffff, 1, 1);
 }
 
 static struct rr_ui_element *region_join_button_init()
@@ -22,6 +22,7 @@ struct rr_squad_member;
 struct rr_ui_element;
 struct rr_game_squad_client;
 struct rr_game_squad;
+struct rr_ui_layer;
 
 enum rr_ui_resizeable_type
 {
@@ -88,6 +89,8 @@ struct rr_ui_element
     void (*on_hide)(struct rr_ui_element *, struct rr_game *);
     void (*on_event)(struct rr_ui_element *, struct rr_game *);
     void (*poll_events)(struct rr_ui_element *, struct rr_game *);
+    // set by rr_ui_cache_layer
+    struct rr_ui_layer *layer;
     float x;
     float y;
     float width;
@@ -100,6 +103,11 @@ struct rr_ui_element
     uint32_t fill;
     uint32_t stroke;
     float stroke_width;
+    // size as of the parent's last layout check
+    float laid_out_width;
+    float laid_out_height;
+    float laid_out_abs_width;
+    float laid_out_abs_height;
     int8_t h_justify;
     int8_t v_justify;
     uint8_t resizeable;
@@ -109,6 +117,8 @@ struct rr_ui_element
     uint8_t prevent_on_event : 1;
     uint8_t allow_overlap : 1;
     uint8_t no_reposition : 1;
+    uint8_t laid_out_hidden : 1;
+    uint8_t layout_dirty : 1;
     uint8_t h_flex;
     uint8_t v_flex;
 };
@@ -132,6 +142,7 @@ void rr_ui_instant_hide_animate(struct rr_ui_element *, struct rr_game *);
 struct rr_ui_element *rr_ui_link_toggle(struct rr_ui_element *,
                                         uint8_t (*)(struct rr_ui_element *,
                                                     struct rr_game *));
+struct rr_ui_element *rr_ui_cache_layer(struct rr_ui_element *);
 void rr_ui_container_poll_events(struct rr_ui_element *, struct rr_game *);
 
 extern struct rr_ui_element *rr_ui_element_init();
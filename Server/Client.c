@@ -29,6 +29,7 @@
 #include <Shared/Component/PlayerInfo.h>
 #include <Shared/Crypto.h>
 #include <Shared/Entity.h>
+#include <Shared/Random.h>
 #include <Shared/pb.h>
 
 double CRAFT_XP_GAINS[rr_rarity_id_max - 1] = {1, 8, 60, 750, 25000, 1000000, 10000000};
@@ -95,6 +96,13 @@ void rr_server_client_write_message(struct rr_server_client *this,
     }
     if (this->received_first_packet)
     {
+        // each record is (tick, size) followed by the packet
+        if (this->server->recording != NULL && this == this->server->clients)
+        {
+            uint32_t header[2] = {this->server->recording_tick, size};
+            fwrite(header, sizeof header, 1, this->server->recording);
+            fwrite(data, size, 1, this->server->recording);
+        }
         this->clientbound_encryption_key =
             rr_get_hash(this->clientbound_encryption_key);
         rr_encrypt(data, size, this->clientbound_encryption_key);
@@ -148,6 +156,34 @@ void rr_server_client_write_account(struct rr_server_client *client)
                                    encoder.current - encoder.start);
 }
 
+// spends up to `fails` failed attempts (1 to 4 petals each) and stops early
+// once fewer than 5 petals are left. every fail cost is two random bits, so a
+// whole batch of 16 is the popcount of one random word
+static uint32_t craft_fail_run(uint32_t *now, uint32_t fails)
+{
+    uint32_t made = 0;
+    while (made < fails && *now >= 5)
+    {
+        uint32_t bits = rr_random_next(RR_RANDOM_STREAM(craft));
+        uint32_t batch = fails - made < 16 ? fails - made : 16;
+        if (*now >= 5 + 4 * batch)
+        {
+            if (batch < 16)
+                bits &= (1u << (2 * batch)) - 1;
+            *now -= batch + 2 * __builtin_popcount(bits & 0xaaaaaaaa) +
+                    __builtin_popcount(bits & 0x55555555);
+            made += batch;
+            continue;
+        }
+        for (uint32_t i = 0; i < batch && *now >= 5; ++i, bits >>= 2)
+        {
+            *now -= 1 + (bits & 3);
+            ++made;
+        }
+    }
+    return made;
+}
+
 void rr_server_client_craft_petal(struct rr_server_client *this, uint8_t id,
                                   uint8_t rarity, uint32_t count)
 {
@@ -159,20 +195,35 @@ void rr_server_client_craft_petal(struct rr_server_client *this, uint8_t id,
         return;
     uint32_t now = count;
     uint32_t success = 0;
-    double base = RR_CRAFT_CHANCES[rarity];
-    double xp_gain = 0;
+    uint32_t attempts = 0;
+    uint32_t *fails = &this->craft_fails[id][rarity];
+    double const *hazard = RR_CRAFT_FAIL_HAZARD[rarity];
+    uint32_t cap = RR_CRAFT_PITY_CAP[rarity];
+    // instead of rolling every attempt, sample how many attempts the next
+    // success takes given the current pity counter, then pay for the fails in
+    // bulk
     while (now >= 5)
     {
-        if (rr_frand() < base * (++this->craft_fails[id][rarity]))
+        uint32_t until_success = 1;
+        if (*fails + 1 < cap)
         {
-            ++success;
-            this->craft_fails[id][rarity] = 0;
-            now -= 5;
+            double seed = hazard[*fails] - log1p(-RR_FRAND(craft));
+            until_success +=
+                rr_lower_bound(hazard + *fails + 1, cap - *fails, seed);
+            if (*fails + until_success > cap)
+                until_success = cap - *fails;
         }
-        else
-            now -= 1 + rand() % 4;
-        xp_gain += CRAFT_XP_GAINS[rarity];
+        uint32_t made = craft_fail_run(&now, until_success - 1);
+        attempts += made;
+        *fails += made;
+        if (made < until_success - 1 || now < 5)
+            break;
+        ++success;
+        ++attempts;
+        *fails = 0;
+        now -= 5;
     }
+    double xp_gain = attempts * CRAFT_XP_GAINS[rarity];
     this->inventory[id][rarity] -= (count - now);
     this->inventory[id][rarity + 1] += success;
     this->experience += xp_gain;
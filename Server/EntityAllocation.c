@@ -21,9 +21,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <Shared/Random.h>
 #include <Shared/Squad.h>
 #include <Shared/Utilities.h>
 
+#define CENTIPEDE_SEGMENT_COUNT 5
+
 static struct rr_maze_grid DEFAULT_GRID = {0};
 
 static void set_respawn_zone(struct rr_component_arena *arena, uint32_t x,
@@ -34,6 +37,39 @@ static void set_respawn_zone(struct rr_component_arena *arena, uint32_t x,
     arena->respawn_zone.y = 2 * y * dim;
 }
 
+static int entity_free(struct rr_simulation *this, EntityIdx id)
+{
+    return !rr_simulation_has_entity(this, id) &&
+           !rr_bitset_get_bit(this->deleted_last_tick, id);
+}
+
+static void claim_entity(struct rr_simulation *this, EntityIdx id)
+{
+    this->entity_tracker[id] = 1;
+    ++this->entity_hash_tracker[id];
+#ifndef NDEBUG
+    printf("<rr_simulation::entity_create::%d>\n", id);
+#endif
+}
+
+// claims count consecutive ids so that a whole chain ends up next to each
+// other in the component pages. returns RR_NULL_ENTITY if no run is free
+static EntityIdx alloc_entity_run(struct rr_simulation *this, uint32_t count)
+{
+    uint32_t run = 0;
+    for (EntityIdx i = 1; i < RR_MAX_ENTITY_COUNT; i++)
+    {
+        run = entity_free(this, i) ? run + 1 : 0;
+        if (run < count)
+            continue;
+        EntityIdx start = i + 1 - count;
+        for (EntityIdx j = start; j <= i; ++j)
+            claim_entity(this, j);
+        return start;
+    }
+    return RR_NULL_ENTITY;
+}
+
 EntityIdx rr_simulation_alloc_player(struct rr_simulation *this,
                                      EntityIdx arena_id, EntityIdx entity)
 {
@@ -49,16 +85,18 @@ EntityIdx rr_simulation_alloc_player(struct rr_simulation *this,
         rr_simulation_add_relations(this, flower_id);
     struct rr_component_arena *arena = rr_simulation_get_arena(this, arena_id);
     struct rr_spawn_zone *respawn_zone = &arena->respawn_zone;
-    rr_component_physical_set_x(
-        physical, respawn_zone->x + 2 * arena->maze->grid_size * rr_frand());
-    rr_component_physical_set_y(
-        physical, respawn_zone->y + 2 * arena->maze->grid_size * rr_frand());
+    rr_component_physical_set_x(physical,
+                                respawn_zone->x + 2 * arena->maze->grid_size *
+                                                      RR_FRAND(spawn));
+    rr_component_physical_set_y(physical,
+                                respawn_zone->y + 2 * arena->maze->grid_size *
+                                                      RR_FRAND(spawn));
     rr_component_physical_set_radius(physical, 25.0f);
     physical->mass = 10;
     physical->arena = arena_id;
     physical->friction = 0.75;
-    if (rand() < RAND_MAX / 1000)
-        rr_component_physical_set_angle(physical, rr_frand() * M_PI * 2);
+    if (RR_FRAND(spawn) < 0.001)
+        rr_component_physical_set_angle(physical, RR_FRAND(spawn) * M_PI * 2);
 
     memcpy(rr_simulation_add_flower(this, flower_id)->nickname,
            player_info->squad_member->nickname,
@@ -96,7 +134,7 @@ EntityIdx rr_simulation_alloc_petal(struct rr_simulation *this, EntityIdx arena,
     struct rr_component_health *health =
         rr_simulation_add_health(this, petal_id);
     rr_component_physical_set_radius(physical, 10);
-    rr_component_physical_set_angle(physical, rr_frand() * M_PI * 2);
+    rr_component_physical_set_angle(physical, RR_FRAND(spawn) * M_PI * 2);
     rr_component_physical_set_x(physical, x);
     rr_component_physical_set_y(physical, y);
     physical->arena = arena;
@@ -134,12 +172,10 @@ EntityIdx rr_simulation_alloc_petal(struct rr_simulation *this, EntityIdx arena,
 }
 
 static EntityIdx rr_simulation_alloc_mob_non_recursive(
-    struct rr_simulation *this, EntityIdx arena_id, float x, float y,
-    enum rr_mob_id mob_id, enum rr_rarity_id rarity_id,
+    struct rr_simulation *this, EntityIdx entity, EntityIdx arena_id, float x,
+    float y, enum rr_mob_id mob_id, enum rr_rarity_id rarity_id,
     enum rr_simulation_team_id team_id)
 {
-    EntityIdx entity = rr_simulation_alloc_entity(this);
-
     struct rr_component_arena *arena = rr_simulation_get_arena(this, 1);
 
     struct rr_component_mob *mob = rr_simulation_add_mob(this, entity);
@@ -158,7 +194,7 @@ static EntityIdx rr_simulation_alloc_mob_non_recursive(
     struct rr_mob_data const *mob_data = RR_MOB_DATA + mob_id;
     rr_component_physical_set_radius(physical,
                                      mob_data->radius * rarity_scale->radius);
-    rr_component_physical_set_angle(physical, rr_frand() * 2 * M_PI);
+    rr_component_physical_set_angle(physical, RR_FRAND(spawn) * 2 * M_PI);
     rr_component_physical_set_x(physical, x);
     rr_component_physical_set_y(physical, y);
     physical->arena = arena_id;
@@ -181,7 +217,12 @@ EntityIdx rr_simulation_alloc_mob(struct rr_simulation *this,
                                   enum rr_rarity_id rarity_id,
                                   enum rr_simulation_team_id team_id)
 {
-    EntityIdx entity = rr_simulation_alloc_entity(this);
+    EntityIdx segments = RR_NULL_ENTITY;
+    if (mob_id == rr_mob_id_house_centipede)
+        segments = alloc_entity_run(this, CENTIPEDE_SEGMENT_COUNT + 1);
+    EntityIdx entity = segments != RR_NULL_ENTITY
+                           ? segments
+                           : rr_simulation_alloc_entity(this);
 
     struct rr_component_mob *mob = rr_simulation_add_mob(this, entity);
     struct rr_component_physical *physical =
@@ -198,7 +239,7 @@ EntityIdx rr_simulation_alloc_mob(struct rr_simulation *this,
     struct rr_mob_data const *mob_data = RR_MOB_DATA + mob_id;
     rr_component_physical_set_radius(physical,
                                      mob_data->radius * rarity_scale->radius);
-    rr_component_physical_set_angle(physical, rr_frand() * 2 * M_PI);
+    rr_component_physical_set_angle(physical, RR_FRAND(spawn) * 2 * M_PI);
     rr_component_physical_set_x(physical, x);
     rr_component_physical_set_y(physical, y);
     physical->arena = arena_id;
@@ -230,8 +271,9 @@ EntityIdx rr_simulation_alloc_mob(struct rr_simulation *this,
                     continue;
                 ++arena->mob_count;
                 rr_simulation_alloc_mob(
-                    this, entity, (X + rr_frand()) * arena->maze->grid_size,
-                    (Y + rr_frand()) * arena->maze->grid_size,
+                    this, entity,
+                    (X + RR_FRAND(spawn)) * arena->maze->grid_size,
+                    (Y + RR_FRAND(spawn)) * arena->maze->grid_size,
                     rr_mob_id_honeybee, rarity_id, team_id);
             }
         }
@@ -259,10 +301,14 @@ EntityIdx rr_simulation_alloc_mob(struct rr_simulation *this,
             rr_vector_from_polar(&extension, -physical->radius * 2,
                                  physical->angle);
             EntityIdx new_entity = RR_NULL_ENTITY;
-            for (uint64_t i = 0; i < 5; ++i)
+            for (uint64_t i = 0; i < CENTIPEDE_SEGMENT_COUNT; ++i)
             {
-                new_entity = rr_simulation_alloc_mob_non_recursive(
-                    this, arena_id, physical->x + extension.x * (i + 1),
+                new_entity = segments != RR_NULL_ENTITY
+                                 ? segments + i + 1
+                                 : rr_simulation_alloc_entity(this);
+                rr_simulation_alloc_mob_non_recursive(
+                    this, new_entity, arena_id,
+                    physical->x + extension.x * (i + 1),
                     physical->y + extension.y * (i + 1), mob_id, rarity_id,
                     team_id);
                 centipede->child_node =
@@ -282,15 +328,9 @@ EntityIdx rr_simulation_alloc_entity(struct rr_simulation *this)
 {
     for (EntityIdx i = 1; i < RR_MAX_ENTITY_COUNT; i++)
     {
-        if (!rr_simulation_has_entity(this, i))
+        if (entity_free(this, i))
         {
-            if (rr_bitset_get_bit(this->deleted_last_tick, i))
-                continue;
-            this->entity_tracker[i] = 1;
-            ++this->entity_hash_tracker[i];
-#ifndef NDEBUG
-            printf("<rr_simulation::entity_create::%d>\n", i);
-#endif
+            claim_entity(this, i);
             return i;
         }
     }
@@ -36,18 +36,9 @@ void shg_cb_enemy(EntityIdx potential, void *_captures)
 {
     struct entity_finder_captures *captures = _captures;
     struct rr_simulation *simulation = captures->simulation;
-    uint8_t allow =
-        !rr_simulation_has_arena(simulation, potential) &&
-        (rr_simulation_has_flower(simulation, potential) ||
-         rr_simulation_has_mob(simulation, potential) ||
-         (rr_simulation_has_petal(simulation, potential) &&
-          rr_simulation_get_petal(simulation, potential)->id ==
-              rr_petal_id_seed &&
-          rr_simulation_get_petal(simulation, potential)->detached));
-    if (!allow)
-        return;
-    if (rr_simulation_get_relations(simulation, potential)->team ==
-        captures->seeker_team)
+    // flowers, mobs and seeds of other teams only, see query_enemies
+    if (rr_simulation_has_petal(simulation, potential) &&
+        !rr_simulation_get_petal(simulation, potential)->detached)
         return;
     if (rr_simulation_get_health(simulation, potential)->health == 0)
         return;
@@ -131,8 +122,9 @@ EntityIdx rr_simulation_find_nearest_enemy_custom_pos(
     shg_captures.seeker_team = relations->team;
     struct rr_spatial_hash *shg =
         &rr_simulation_get_arena(simulation, physical->arena)->spatial_hash;
-    rr_spatial_hash_query(shg, x, y, min_dist, min_dist, &shg_captures,
-                          shg_cb_enemy);
+    rr_spatial_hash_query_enemies(shg, x, y, min_dist, min_dist,
+                                  relations->team, &shg_captures,
+                                  shg_cb_enemy);
 
     return shg_captures.closest;
 }
@@ -29,6 +29,7 @@
 #include <Server/Server.h>
 #include <Shared/Api.h>
 #include <Shared/MagicNumber.h>
+#include <Shared/Random.h>
 #include <Shared/Rivet.h>
 #include <Shared/StaticData.h>
 #include <Shared/Utilities.h>
@@ -36,7 +37,9 @@
 int main()
 {
     fprintf(stderr, "gameserver on version %llu\n", RR_SECRET8 ^ 255);
-    srand(time(0));
+    // fixed seeds make spawns, drops and crafts reproducible for benchmarks
+    char const *seed = getenv("RR_RANDOM_SEED");
+    rr_random_seed_streams(seed ? strtoull(seed, NULL, 10) : time(0));
     // signal(SIGINT, sigint_handle);
 #ifdef RIVET_BUILD
     curl_global_init(CURL_GLOBAL_ALL);
@@ -20,6 +20,7 @@
 #include <Server/EntityAllocation.h>
 #include <Server/EntityDetection.h>
 #include <Server/Simulation.h>
+#include <Shared/Random.h>
 
 void tick_ai_aggro_default(EntityIdx entity, struct rr_simulation *simulation,
                            float speed)
@@ -116,7 +117,7 @@ void tick_ai_aggro_trex(EntityIdx entity, struct rr_simulation *simulation)
         {
             struct rr_component_mob *mob =
                 rr_simulation_get_mob(simulation, entity);
-            float angle = rr_frand() * M_PI + M_PI / 2;
+            float angle = RR_FRAND(ai) * M_PI + M_PI / 2;
             rr_simulation_alloc_mob(
                 simulation, physical->arena,
                 physical->x + physical->radius * cosf(angle),
@@ -180,7 +181,7 @@ void tick_ai_aggro_pteranodon(EntityIdx entity,
         {
             if (rr_simulation_get_mob(simulation, entity)->rarity >=
                     rr_rarity_id_exotic &&
-                rr_frand() < 0.2)
+                RR_FRAND(ai) < 0.2)
             {
                 ai->ai_state = rr_ai_state_exotic_special;
                 ai->ticks_until_next_action = 75;
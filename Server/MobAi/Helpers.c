@@ -19,6 +19,7 @@
 
 #include <Server/EntityDetection.h>
 #include <Server/Simulation.h>
+#include <Shared/Random.h>
 
 static uint8_t is_close_enough_to_parent(struct rr_simulation *simulation,
                                          EntityIdx seeker, EntityIdx target,
@@ -69,7 +70,7 @@ uint8_t has_new_target(struct rr_component_ai *ai,
     {
         ai->target_entity = RR_NULL_ENTITY;
         ai->ai_state = rr_ai_state_idle;
-        ai->ticks_until_next_action = rand() % 25 + 25;
+        ai->ticks_until_next_action = RR_RAND_BELOW(ai, 25) + 25;
     }
     return 0;
 }
@@ -100,10 +101,10 @@ void tick_idle(EntityIdx entity, struct rr_simulation *simulation)
 
     if (ai->ticks_until_next_action == 0)
     {
-        ai->ticks_until_next_action = rand() % 33 + 25;
+        ai->ticks_until_next_action = RR_RAND_BELOW(ai, 33) + 25;
         ai->ai_state = rr_ai_state_idle_moving;
         rr_component_physical_set_angle(
-            physical, physical->angle + (rr_frand() - 0.5) * M_PI);
+            physical, physical->angle + (RR_FRAND(ai) - 0.5) * M_PI);
         physical->bearing_angle = physical->angle;
     }
 }
@@ -115,7 +116,7 @@ void tick_idle_move_default(EntityIdx entity, struct rr_simulation *simulation)
         rr_simulation_get_physical(simulation, entity);
     if (ai->ticks_until_next_action == 0)
     {
-        ai->ticks_until_next_action = 12 + rr_frand() * 37;
+        ai->ticks_until_next_action = 12 + RR_FRAND(ai) * 37;
         ai->ai_state = rr_ai_state_idle;
     }
     struct rr_vector accel;
@@ -178,7 +179,7 @@ uint8_t tick_summon_return_to_owner(EntityIdx entity,
     else if (ai->ai_state == rr_ai_state_returning_to_owner)
     {
         ai->ai_state = rr_ai_state_idle;
-        ai->ticks_until_next_action = rand() % 25 + 25;
+        ai->ticks_until_next_action = RR_RAND_BELOW(ai, 25) + 25;
         return 0;
     }
     return 0;
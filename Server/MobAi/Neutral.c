@@ -19,6 +19,7 @@
 
 #include <Server/EntityDetection.h>
 #include <Server/Simulation.h>
+#include <Shared/Random.h>
 
 void tick_ai_neutral_default(EntityIdx entity, struct rr_simulation *simulation,
                              float speed)
@@ -95,7 +96,7 @@ void tick_ai_neutral_triceratops(EntityIdx entity,
         if (ai->ticks_until_next_action == 0)
         {
             ai->ai_state = rr_ai_state_attacking;
-            ai->ticks_until_next_action = rand() % 25 + 63;
+            ai->ticks_until_next_action = RR_RAND_BELOW(ai, 25) + 63;
             break;
         }
 
@@ -115,7 +116,7 @@ void tick_ai_neutral_triceratops(EntityIdx entity,
         if (ai->ticks_until_next_action == 0)
         {
             ai->ai_state = rr_ai_state_waiting_to_attack;
-            ai->ticks_until_next_action = rand() % 12 + 12;
+            ai->ticks_until_next_action = RR_RAND_BELOW(ai, 12) + 12;
             break;
         }
 
@@ -228,7 +229,7 @@ void tick_ai_neutral_ankylosaurus(EntityIdx entity,
         {
             ai->ai_state = (rr_simulation_get_mob(simulation, entity)->rarity >=
                                 rr_rarity_id_exotic &&
-                            rr_frand() < 0.2)
+                            RR_FRAND(ai) < 0.2)
                                ? rr_ai_state_exotic_special
                                : rr_ai_state_charging;
             ai->ticks_until_next_action = 25;
@@ -19,6 +19,7 @@
 
 #include <Server/EntityDetection.h>
 #include <Server/Simulation.h>
+#include <Shared/Random.h>
 
 void tick_ai_passive_default(EntityIdx entity, struct rr_simulation *simulation)
 {
@@ -49,7 +50,7 @@ void tick_ai_passive_meteor(EntityIdx entity, struct rr_simulation *simulation)
     switch (ai->ai_state)
     {
     case rr_ai_state_idle:
-        physical->bearing_angle = rr_frand() * M_PI * 2;
+        physical->bearing_angle = RR_FRAND(ai) * M_PI * 2;
         ai->ai_state = rr_ai_state_idle_moving;
         break;
     case rr_ai_state_idle_moving:
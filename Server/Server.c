@@ -121,9 +121,46 @@ void rr_server_client_free(struct rr_server_client *this)
     }
     this->message_at = this->message_root = NULL;
     this->message_length = 0;
+    // the recording follows one session, a later client reusing slot 0
+    // would get spliced onto it
+    if (this->server->recording != NULL && this == this->server->clients &&
+        this->received_first_packet)
+    {
+        fclose(this->server->recording);
+        this->server->recording = NULL;
+    }
     puts("<rr_server::client_disconnect>");
 }
 
+// same box the entity update uses, with some room for bolts that end
+// just off screen
+#define ANIMATION_VIEW_MARGIN (200)
+
+static uint8_t animation_point_in_view(struct rr_component_player_info *view,
+                                       float x, float y)
+{
+    float half_width = 1280.0f / view->camera_fov + ANIMATION_VIEW_MARGIN;
+    float half_height = 720.0f / view->camera_fov + ANIMATION_VIEW_MARGIN;
+    return fabsf(x - view->camera_x) < half_width &&
+           fabsf(y - view->camera_y) < half_height;
+}
+
+static uint8_t animation_in_view(struct rr_simulation_animation *animation,
+                                 struct rr_component_player_info *view)
+{
+    if (view == NULL || animation->arena != view->arena)
+        return 0;
+    if (animation->type == rr_animation_type_damagenumber)
+        return animation_point_in_view(view, animation->x, animation->y);
+    for (uint32_t i = 0; i < animation->length; ++i)
+        if (animation_point_in_view(view, animation->points[i].x,
+                                    animation->points[i].y))
+            return 1;
+    return 0;
+}
+
+// positions are sent rounded to whole units, bolt points after the first as
+// the offset from the previous one
 static void write_animation_function(struct rr_simulation *simulation,
                                      struct proto_bug *encoder,
                                      struct rr_server_client *client,
@@ -133,21 +170,34 @@ static void write_animation_function(struct rr_simulation *simulation,
     if (animation->type == rr_animation_type_damagenumber &&
         animation->squad != client->squad)
         return;
+    if (animation->type != rr_animation_type_chat &&
+        !animation_in_view(animation, client->player_info))
+        return;
     proto_bug_write_uint8(encoder, 1, "continue");
     proto_bug_write_uint8(encoder, animation->type, "ani type");
     switch (animation->type)
     {
     case rr_animation_type_lightningbolt:
+    {
         proto_bug_write_uint8(encoder, animation->length, "ani length");
+        int32_t x = 0;
+        int32_t y = 0;
         for (uint32_t i = 0; i < animation->length; ++i)
         {
-            proto_bug_write_float32(encoder, animation->points[i].x, "ani x");
-            proto_bug_write_float32(encoder, animation->points[i].y, "ani y");
+            int32_t next_x = lroundf(animation->points[i].x);
+            int32_t next_y = lroundf(animation->points[i].y);
+            proto_bug_write_varuint(encoder, rr_zigzag_encode(next_x - x),
+                                    "ani x");
+            proto_bug_write_varuint(encoder, rr_zigzag_encode(next_y - y),
+                                    "ani y");
+            x = next_x;
+            y = next_y;
         }
         break;
+    }
     case rr_animation_type_damagenumber:
-        proto_bug_write_float32(encoder, animation->x, "ani x");
-        proto_bug_write_float32(encoder, animation->y, "ani y");
+        proto_bug_write_varuint(encoder, lroundf(animation->x), "ani x");
+        proto_bug_write_varuint(encoder, lroundf(animation->y), "ani y");
         proto_bug_write_varuint(encoder, animation->damage, "damage");
         break;
     case rr_animation_type_chat:
@@ -163,33 +213,47 @@ void rr_server_client_broadcast_update(struct rr_server_client *this)
     struct rr_simulation *simulation = &server->simulation;
     struct proto_bug encoder;
     proto_bug_init(&encoder, outgoing_message);
-    proto_bug_write_uint8(&encoder, rr_clientbound_update, "header");
-
     struct rr_squad *squad = rr_client_get_squad(server, this);
-    for (uint32_t i = 0; i < RR_SQUAD_MEMBER_COUNT; ++i)
+    // the squad header only goes out when the squad changed, updates just
+    // say which version they were built against
+    if (this->squad_version != squad->version)
     {
-        if (squad->members[i].in_use == 0)
-        {
-            proto_bug_write_uint8(&encoder, 0, "bitbit");
-            continue;
-        }
-        struct rr_squad_member *member = &squad->members[i];
-        proto_bug_write_uint8(&encoder, 1, "bitbit");
-        proto_bug_write_uint8(&encoder, member->playing, "ready");
-        proto_bug_write_uint8(&encoder, member->is_dev, "is_dev");
-        proto_bug_write_string(&encoder, member->nickname, 16, "nickname");
-        for (uint8_t j = 0; j < 20; ++j)
+        this->squad_version = squad->version;
+        proto_bug_write_uint8(&encoder, rr_clientbound_squad_update,
+                              "header");
+        for (uint32_t i = 0; i < RR_SQUAD_MEMBER_COUNT; ++i)
         {
-            proto_bug_write_uint8(&encoder, member->loadout[j].id, "id");
-            proto_bug_write_uint8(&encoder, member->loadout[j].rarity, "rar");
+            if (squad->members[i].in_use == 0)
+            {
+                proto_bug_write_uint8(&encoder, 0, "bitbit");
+                continue;
+            }
+            struct rr_squad_member *member = &squad->members[i];
+            proto_bug_write_uint8(&encoder, 1, "bitbit");
+            proto_bug_write_uint8(&encoder, member->playing, "ready");
+            proto_bug_write_uint8(&encoder, member->is_dev, "is_dev");
+            proto_bug_write_string(&encoder, member->nickname, 16,
+                                   "nickname");
+            for (uint8_t j = 0; j < 20; ++j)
+            {
+                proto_bug_write_uint8(&encoder, member->loadout[j].id, "id");
+                proto_bug_write_uint8(&encoder, member->loadout[j].rarity,
+                                      "rar");
+            }
         }
+        proto_bug_write_uint8(&encoder, this->squad_pos, "sqpos");
+        proto_bug_write_uint8(&encoder, squad->private, "private");
+        proto_bug_write_uint8(&encoder, RR_GLOBAL_BIOME, "biome");
+        char joined_code[16];
+        sprintf(joined_code, "%s-%s", server->server_alias,
+                squad->squad_code);
+        proto_bug_write_string(&encoder, joined_code, 16, "squad code");
+        rr_server_client_write_message(this, encoder.start,
+                                       encoder.current - encoder.start);
+        proto_bug_init(&encoder, outgoing_message);
     }
-    proto_bug_write_uint8(&encoder, this->squad_pos, "sqpos");
-    proto_bug_write_uint8(&encoder, squad->private, "private");
-    proto_bug_write_uint8(&encoder, RR_GLOBAL_BIOME, "biome");
-    char joined_code[16];
-    sprintf(joined_code, "%s-%s", server->server_alias, squad->squad_code);
-    proto_bug_write_string(&encoder, joined_code, 16, "squad code");
+    proto_bug_write_uint8(&encoder, rr_clientbound_update, "header");
+    proto_bug_write_varuint(&encoder, squad->version, "squad version");
     proto_bug_write_uint8(&encoder, this->player_info != NULL, "in game");
     if (this->player_info != NULL)
         rr_simulation_write_binary(&server->simulation, &encoder,
@@ -220,6 +284,9 @@ void rr_server_init(struct rr_server *this)
     RR_FOR_EACH_COMPONENT;
 #undef XX
     memset(this, 0, sizeof *this);
+    char const *record_path = getenv("RR_RECORD_PATH");
+    if (record_path != NULL)
+        this->recording = fopen(record_path, "wb");
 #ifndef RIVET_BUILD
     // RR_GLOBAL_BIOME = rr_biome_id_garden;
 #endif
@@ -232,6 +299,8 @@ void rr_server_init(struct rr_server *this)
 void rr_server_free(struct rr_server *this)
 {
     lws_context_destroy(this->server);
+    if (this->recording != NULL)
+        fclose(this->recording);
 }
 
 static void rr_simulation_tick_entity_resetter_function(EntityIdx entity,
@@ -628,6 +697,7 @@ static int handle_lws_event(struct rr_server *this, struct lws *ws,
                         client->player_info = NULL;
                     }
                     rr_squad_get_client_slot(this, client)->playing = 1;
+                    rr_squad_changed(this, client->squad);
                     rr_server_client_create_player_info(this, client);
                     rr_server_client_create_flower(client);
                 }
@@ -648,6 +718,7 @@ static int handle_lws_event(struct rr_server *this, struct lws *ws,
                                 client->player_info->parent_id);
                             client->player_info = NULL;
                             rr_squad_get_client_slot(this, client)->playing = 0;
+                            rr_squad_changed(this, client->squad);
                         }
                     }
                 }
@@ -658,18 +729,28 @@ static int handle_lws_event(struct rr_server *this, struct lws *ws,
         {
             if (!client->in_squad)
                 break;
-            proto_bug_read_string(
-                &encoder, rr_squad_get_client_slot(this, client)->nickname, 16,
-                "nickname");
+            struct rr_squad_member *member =
+                rr_squad_get_client_slot(this, client);
+            if (member == NULL)
+                break;
+            // squad headers only go out on a version change, so a new
+            // nickname has to bump it even if the loadout is rejected
+            char nickname[16] = {0};
+            proto_bug_read_string(&encoder, nickname, 16, "nickname");
+            if (strncmp(nickname, member->nickname, sizeof nickname))
+            {
+                memcpy(member->nickname, nickname, sizeof nickname);
+                rr_squad_changed(this, client->squad);
+            }
             uint8_t loadout_count =
                 proto_bug_read_uint8(&encoder, "loadout count");
 
             if (loadout_count > 10)
                 break;
-            struct rr_squad_member *member =
-                rr_squad_get_client_slot(this, client);
-            if (member == NULL)
-                break;
+            // lobby clients resend their loadout every tick, so the squad is
+            // only marked changed when the loadout actually differs
+            struct rr_id_rarity_pair loadout[20];
+            memcpy(loadout, member->loadout, sizeof loadout);
             uint32_t temp_inv[rr_petal_id_max][rr_rarity_id_max];
 
             memcpy(temp_inv, client->inventory, sizeof client->inventory);
@@ -681,11 +762,11 @@ static int handle_lws_event(struct rr_server *this, struct lws *ws,
                     break;
                 if (rarity >= rr_rarity_id_max)
                     break;
-                member->loadout[i].rarity = rarity;
-                member->loadout[i].id = id;
+                loadout[i].rarity = rarity;
+                loadout[i].id = id;
                 if (id && temp_inv[id][rarity]-- == 0)
                 {
-                    memset(member->loadout, 0, sizeof member->loadout);
+                    memset(loadout, 0, sizeof loadout);
                     break;
                 }
                 id = proto_bug_read_uint8(&encoder, "id");
@@ -694,14 +775,19 @@ static int handle_lws_event(struct rr_server *this, struct lws *ws,
                     break;
                 if (rarity >= rr_rarity_id_max)
                     break;
-                member->loadout[i + 10].rarity = rarity;
-                member->loadout[i + 10].id = id;
+                loadout[i + 10].rarity = rarity;
+                loadout[i + 10].id = id;
                 if (id && temp_inv[id][rarity]-- == 0)
                 {
-                    memset(member->loadout, 0, sizeof member->loadout);
+                    memset(loadout, 0, sizeof loadout);
                     break;
                 }
             }
+            if (memcmp(loadout, member->loadout, sizeof loadout))
+            {
+                memcpy(member->loadout, loadout, sizeof loadout);
+                rr_squad_changed(this, client->squad);
+            }
             if (client->pending_quick_join)
             {
                 client->pending_quick_join = 0;
@@ -714,6 +800,7 @@ static int handle_lws_event(struct rr_server *this, struct lws *ws,
                         client->player_info = NULL;
                     }
                     member->playing = 1;
+                    rr_squad_changed(this, client->squad);
                     rr_server_client_create_player_info(this, client);
                     rr_server_client_create_flower(client);
                 }
@@ -725,6 +812,7 @@ static int handle_lws_event(struct rr_server *this, struct lws *ws,
                             &this->simulation, client->player_info->parent_id);
                         client->player_info = NULL;
                         member->playing = 0;
+                        rr_squad_changed(this, client->squad);
                     }
                 }
             }
@@ -733,7 +821,10 @@ static int handle_lws_event(struct rr_server *this, struct lws *ws,
         case rr_serverbound_private_update:
         {
             if (client->in_squad)
+            {
                 rr_client_get_squad(this, client)->private = 0;
+                rr_squad_changed(this, client->squad);
+            }
             break;
         }
         case rr_serverbound_squad_kick:
@@ -786,10 +877,9 @@ static int handle_lws_event(struct rr_server *this, struct lws *ws,
             if (!client->player_info)
                 break;
             struct rr_simulation_animation *animation =
-                &this->simulation
-                     .animations[this->simulation.animation_length++];
+                rr_simulation_add_animation(&this->simulation,
+                                            rr_animation_type_chat);
             proto_bug_read_string(&encoder, animation->message, 64, "chat");
-            animation->type = rr_animation_type_chat;
             animation->squad = client->squad;
             strncpy(animation->name,
                     rr_squad_get_client_slot(this, client)->nickname, 64);
@@ -864,6 +954,9 @@ static int api_lws_callback(struct lws *ws, enum lws_callback_reasons reason,
         case 0:
         {
             rr_binary_encoder_read_nt_string(&decoder, this->server_alias);
+            // the alias is part of every squad code clients were sent
+            for (uint8_t i = 0; i < RR_SQUAD_COUNT; ++i)
+                rr_squad_changed(this, i);
             break;
         }
         case 1:
@@ -979,11 +1072,61 @@ void *thread_func(void *arg)
 
 static void lws_log(int level, char const *log) { printf("%d %s", level, log); }
 
+// only squads that changed since the last tick are sent, unless the client
+// needs all of them
+static void write_squad_dump(struct rr_server *this,
+                             struct rr_server_client *client, uint8_t full)
+{
+    struct proto_bug encoder;
+    proto_bug_init(&encoder, outgoing_message);
+    proto_bug_write_uint8(&encoder, rr_clientbound_squad_dump, "header");
+    for (uint32_t s = 0; s < RR_SQUAD_COUNT; ++s)
+    {
+        if (!full && !rr_bitset_get(this->dirty_squads, s))
+            continue;
+        struct rr_squad *squad = &this->squads[s];
+        proto_bug_write_uint8(&encoder, 1, "continue");
+        proto_bug_write_uint8(&encoder, s, "squad index");
+        for (uint32_t i = 0; i < RR_SQUAD_MEMBER_COUNT; ++i)
+        {
+            if (squad->members[i].in_use == 0)
+            {
+                proto_bug_write_uint8(&encoder, 0, "bitbit");
+                continue;
+            }
+            struct rr_squad_member *member = &squad->members[i];
+            proto_bug_write_uint8(&encoder, 1, "bitbit");
+            proto_bug_write_uint8(&encoder, member->playing, "ready");
+            proto_bug_write_uint8(&encoder, member->is_dev, "is_dev");
+            proto_bug_write_string(&encoder, member->nickname, 16, "nickname");
+            for (uint8_t j = 0; j < 20; ++j)
+            {
+                proto_bug_write_uint8(&encoder, member->loadout[j].id, "id");
+                proto_bug_write_uint8(&encoder, member->loadout[j].rarity,
+                                      "rar");
+            }
+        }
+        proto_bug_write_uint8(&encoder, squad->private, "private");
+        proto_bug_write_uint8(&encoder, RR_GLOBAL_BIOME, "biome");
+        char joined_code[16];
+        sprintf(joined_code, "%s-%s", this->server_alias, squad->squad_code);
+        proto_bug_write_string(&encoder, joined_code, 16, "squad code");
+    }
+    proto_bug_write_uint8(&encoder, 0, "continue");
+    rr_server_client_write_message(client, encoder.start,
+                                   encoder.current - encoder.start);
+}
+
 static void server_tick(struct rr_server *this)
 {
     if (!this->api_ws_ready)
         return;
     rr_simulation_tick(&this->simulation);
+    if (this->recording != NULL)
+        ++this->recording_tick;
+    uint8_t squads_changed = 0;
+    for (uint32_t i = 0; i < RR_BITSET_ROUND(RR_SQUAD_COUNT); ++i)
+        squads_changed |= this->dirty_squads[i];
     for (uint64_t i = 0; i < RR_MAX_CLIENT_COUNT; ++i)
     {
         if (rr_bitset_get(this->clients_in_use, i))
@@ -994,7 +1137,11 @@ static void server_tick(struct rr_server *this)
             if (client->ticks_to_next_squad_action > 0)
                 --client->ticks_to_next_squad_action;
             if (!client->verified || !client->in_squad)
+            {
+                // missed dumps while away, resend everything on return
+                client->received_squad_dump = 0;
                 continue;
+            }
             if (client->player_info != NULL)
             {
                 if (rr_simulation_entity_alive(&this->simulation,
@@ -1012,7 +1159,8 @@ static void server_tick(struct rr_server *this)
                         uint8_t id = client->player_info->drops_this_tick[i].id;
                         uint8_t rarity =
                             client->player_info->drops_this_tick[i].rarity;
-                        ++client->inventory[id][rarity];
+                        client->inventory[id][rarity] +=
+                            client->player_info->drops_this_tick[i].count;
                     }
                     rr_server_client_write_to_api(client);
                     rr_server_client_write_account(client);
@@ -1022,45 +1170,14 @@ static void server_tick(struct rr_server *this)
             rr_server_client_broadcast_update(client);
             if (!client->dev)
                 continue;
-            struct proto_bug encoder;
-            proto_bug_init(&encoder, outgoing_message);
-            proto_bug_write_uint8(&encoder, rr_clientbound_squad_dump,
-                                  "header");
-            for (uint32_t s = 0; s < RR_SQUAD_COUNT; ++s)
-            {
-                struct rr_squad *squad = &this->squads[s];
-                for (uint32_t i = 0; i < RR_SQUAD_MEMBER_COUNT; ++i)
-                {
-                    if (squad->members[i].in_use == 0)
-                    {
-                        proto_bug_write_uint8(&encoder, 0, "bitbit");
-                        continue;
-                    }
-                    struct rr_squad_member *member = &squad->members[i];
-                    proto_bug_write_uint8(&encoder, 1, "bitbit");
-                    proto_bug_write_uint8(&encoder, member->playing, "ready");
-                    proto_bug_write_uint8(&encoder, member->is_dev, "is_dev");
-                    proto_bug_write_string(&encoder, member->nickname, 16,
-                                           "nickname");
-                    for (uint8_t j = 0; j < 20; ++j)
-                    {
-                        proto_bug_write_uint8(&encoder, member->loadout[j].id,
-                                              "id");
-                        proto_bug_write_uint8(&encoder,
-                                              member->loadout[j].rarity, "rar");
-                    }
-                }
-                proto_bug_write_uint8(&encoder, squad->private, "private");
-                proto_bug_write_uint8(&encoder, RR_GLOBAL_BIOME, "biome");
-                char joined_code[16];
-                sprintf(joined_code, "%s-%s", this->server_alias,
-                        squad->squad_code);
-                proto_bug_write_string(&encoder, joined_code, 16, "squad code");
-            }
-            rr_server_client_write_message(client, encoder.start,
-                                           encoder.current - encoder.start);
+            if (!client->received_squad_dump)
+                write_squad_dump(this, client, 1);
+            else if (squads_changed)
+                write_squad_dump(this, client, 0);
+            client->received_squad_dump = 1;
         }
     }
+    memset(this->dirty_squads, 0, sizeof this->dirty_squads);
     rr_simulation_for_each_entity(&this->simulation, &this->simulation,
                                   rr_simulation_tick_entity_resetter_function);
 }
@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <stdio.h>
+
 #include <Server/Client.h>
 #include <Server/Simulation.h>
 #include <Server/Squad.h>
@@ -42,6 +44,20 @@ struct rr_server
     struct lws_context *api_client_context;
     struct lws *api_client;
     struct rr_squad squads[RR_MAX_CLIENT_COUNT];
+    // first squad (plus one) in each code bucket
+    uint8_t squad_code_buckets[RR_SQUAD_CODE_BUCKET_COUNT];
+    // public squads with a free slot, for matchmaking
+    uint8_t open_squads[RR_BITSET_ROUND(RR_SQUAD_COUNT)];
+    // squads that changed since the last dev squad dump. only set through
+    // rr_squad_changed, which callers must reserve for real changes since
+    // lobby clients resend their squad update every tick
+    uint8_t dirty_squads[RR_BITSET_ROUND(RR_SQUAD_COUNT)];
+    // last version handed out to a squad
+    uint32_t squad_version;
+    // plaintext clientbound stream of the first client slot, replayed by the
+    // client benchmark. only open when RR_RECORD_PATH is set
+    FILE *recording;
+    uint32_t recording_tick;
     uint8_t api_ws_ready;
     char server_alias[16];
 };
@@ -59,6 +75,8 @@ struct rr_squad_member *rr_squad_get_client_slot(struct rr_server *,
                                                  struct rr_server_client *);
 struct rr_squad *rr_client_get_squad(struct rr_server *,
                                      struct rr_server_client *);
+// call after anything in a squad changes
+void rr_squad_changed(struct rr_server *, uint8_t);
 
 // Blocking function. The only time this function will never end unless the
 // server crashes
@@ -29,6 +29,7 @@
 #include <Server/Waves.h>
 #include <Shared/Bitset.h>
 #include <Shared/Crypto.h>
+#include <Shared/Random.h>
 #include <Shared/Utilities.h>
 #include <Shared/pb.h>
 
@@ -69,21 +70,23 @@ uint8_t trike_dako_zone()
 }
 uint8_t pter_zone()
 {
-    return rr_frand() > 0.02 ? rr_mob_id_pteranodon : rr_mob_id_meteor;
+    return RR_FRAND(spawn) > 0.02 ? rr_mob_id_pteranodon : rr_mob_id_meteor;
 }
 uint8_t edmo_dako_zone()
 {
-    return rr_frand() > 0.33 ? rr_mob_id_dakotaraptor : rr_mob_id_edmontosaurus;
+    return RR_FRAND(spawn) > 0.33 ? rr_mob_id_dakotaraptor
+                                  : rr_mob_id_edmontosaurus;
 }
 uint8_t trex_dako_pter_zone()
 {
-    return rr_frand() > 0.6   ? rr_mob_id_trex
-           : rr_frand() > 0.5 ? rr_mob_id_dakotaraptor
+    return RR_FRAND(spawn) > 0.6   ? rr_mob_id_trex
+           : RR_FRAND(spawn) > 0.5 ? rr_mob_id_dakotaraptor
                               : rr_mob_id_pteranodon;
 }
 uint8_t dako_pter_zone()
 {
-    return rr_frand() > 0.5 ? rr_mob_id_dakotaraptor : rr_mob_id_pteranodon;
+    return RR_FRAND(spawn) > 0.5 ? rr_mob_id_dakotaraptor
+                                 : rr_mob_id_pteranodon;
 }
 
 struct zone
@@ -205,7 +208,7 @@ static void spawn_mob(struct rr_simulation *this, uint32_t grid_x,
         rr_component_arena_get_grid(arena, grid_x, grid_y);
     uint8_t id;
 
-    if (grid->spawn_function != NULL && rr_frand() <
+    if (grid->spawn_function != NULL && RR_FRAND(spawn) <
 #ifdef RIVET_BUILD
                                             0.75
 #else
@@ -221,8 +224,9 @@ static void spawn_mob(struct rr_simulation *this, uint32_t grid_x,
         return;
     for (uint32_t n = 0; n < 10; ++n)
     {
-        struct rr_vector pos = {(grid_x + rr_frand()) * arena->maze->grid_size,
-                                (grid_y + rr_frand()) * arena->maze->grid_size};
+        struct rr_vector pos = {
+            (grid_x + RR_FRAND(spawn)) * arena->maze->grid_size,
+            (grid_y + RR_FRAND(spawn)) * arena->maze->grid_size};
         if (too_close(this, pos.x, pos.y,
                       RR_MOB_DATA[id].radius *
                               RR_MOB_RARITY_SCALING[rarity].radius +
@@ -337,7 +341,7 @@ static int tick_grid(struct rr_simulation *this, struct rr_maze_grid *grid,
     {
         grid->overload_factor =
             rr_fclamp(grid->overload_factor - 0.025 / 25, 0, 15);
-        grid->spawn_timer = rr_frand() * 0.75 * spawn_at;
+        grid->spawn_timer = RR_FRAND(spawn) * 0.75 * spawn_at;
     }
     else if (grid->spawn_timer >= spawn_at)
     {
@@ -399,8 +403,8 @@ static void tick_maze(struct rr_simulation *this)
                                 (end.tv_usec - start.tv_usec);                 \
         if (elapsed_time > 3000)                                               \
         {                                                                      \
-            printf(_ " took %lu microseconds with %d entities\n",              \
-                   elapsed_time, this->physical_count);                        \
+            printf(_ " took %lu microseconds with %d entities, %u asleep\n",   \
+                   elapsed_time, this->physical_count, this->sleeping_count);  \
         }                                                                      \
     };
 
@@ -423,6 +427,7 @@ void rr_simulation_tick(struct rr_simulation *this)
         set_spawn_zones();
         last_zone_epoch = current_zone_epoch;
     }
+    ++this->ticks;
     rr_simulation_create_component_vectors(this);
     RR_TIME_BLOCK("collision_detection",
                   { rr_system_collision_detection_tick(this); });
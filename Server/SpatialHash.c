@@ -31,6 +31,9 @@ void rr_spatial_hash_init(struct rr_spatial_hash *this,
     this->simulation = simulation;
     this->cells =
         calloc(sizeof(struct rr_spatial_hash_cell), this->size * this->size);
+    this->target_starts =
+        calloc(this->size * this->size * RR_SPATIAL_HASH_TEAM_COUNT + 1,
+               sizeof *this->target_starts);
 }
 
 void rr_spatial_hash_insert(struct rr_spatial_hash *this, EntityIdx entity)
@@ -49,33 +52,40 @@ void rr_spatial_hash_insert(struct rr_spatial_hash *this, EntityIdx entity)
         SPATIAL_HASH_GRID_SIZE;
     struct rr_spatial_hash_cell *cell = spatial_hash_get(x, y);
     cell->entities[cell->entities_in_use++] = entity;
+    this->targets_valid = 0;
 }
 
 void rr_spatial_hash_update(struct rr_spatial_hash *this, EntityIdx entity) {}
 
-void rr_spatial_hash_query(struct rr_spatial_hash *this, float fx, float fy,
-                           float fw, float fh, void *user_captures,
-                           void (*cb)(EntityIdx, void *))
+static void query_bounds(struct rr_spatial_hash *this, float fx, float fy,
+                         float fw, float fh, uint32_t *s_x, uint32_t *s_y,
+                         uint32_t *e_x, uint32_t *e_y)
 {
-    float x = fmaxf(fx - fw, 0);
-    float y = fmaxf(fy - fh, 0);
     // should not take in an entity id like insert does. the reason is so stuff
     // like ai can query a large radius without a viewing entity
-    uint32_t s_x =
+    *s_x =
         rr_fclamp((fx - fw - SPATIAL_HASH_GRID_SIZE) / SPATIAL_HASH_GRID_SIZE,
                   0, this->size - 1);
 
-    uint32_t s_y =
+    *s_y =
         rr_fclamp((fy - fh - SPATIAL_HASH_GRID_SIZE) / SPATIAL_HASH_GRID_SIZE,
                   0, this->size - 1);
 
-    uint32_t e_x =
+    *e_x =
         rr_fclamp((fx + fw + SPATIAL_HASH_GRID_SIZE) / SPATIAL_HASH_GRID_SIZE,
                   0, this->size - 1);
 
-    uint32_t e_y =
+    *e_y =
         rr_fclamp((fy + fh + SPATIAL_HASH_GRID_SIZE) / SPATIAL_HASH_GRID_SIZE,
                   0, this->size - 1);
+}
+
+void rr_spatial_hash_query(struct rr_spatial_hash *this, float fx, float fy,
+                           float fw, float fh, void *user_captures,
+                           void (*cb)(EntityIdx, void *))
+{
+    uint32_t s_x, s_y, e_x, e_y;
+    query_bounds(this, fx, fy, fw, fh, &s_x, &s_y, &e_x, &e_y);
 
     for (uint32_t y = s_y; y <= e_y; y++)
         for (uint32_t x = s_x; x <= e_x; x++)
@@ -86,6 +96,99 @@ void rr_spatial_hash_query(struct rr_spatial_hash *this, float fx, float fy,
         }
 }
 
+static uint8_t is_target(struct rr_simulation *simulation, EntityIdx entity)
+{
+    if (rr_simulation_has_arena(simulation, entity))
+        return 0;
+    if (rr_simulation_has_flower(simulation, entity) ||
+        rr_simulation_has_mob(simulation, entity))
+        return 1;
+    // detached is checked by the caller, seeds can detach mid tick
+    return rr_simulation_has_petal(simulation, entity) &&
+           rr_simulation_get_petal(simulation, entity)->id == rr_petal_id_seed;
+}
+
+// counting sort of the targets in each cell by (cell, team)
+static void build_targets(struct rr_spatial_hash *this)
+{
+    uint32_t cell_count = this->size * this->size;
+    uint32_t *starts = this->target_starts;
+    memset(starts, 0,
+           (cell_count * RR_SPATIAL_HASH_TEAM_COUNT + 1) * sizeof *starts);
+    uint32_t total = 0;
+    for (uint32_t c = 0; c < cell_count; ++c)
+    {
+        struct rr_spatial_hash_cell *cell = &this->cells[c];
+        for (uint32_t i = 0; i < cell->entities_in_use; ++i)
+        {
+            EntityIdx entity = cell->entities[i];
+            if (!is_target(this->simulation, entity))
+                continue;
+            uint8_t team =
+                rr_simulation_get_relations(this->simulation, entity)->team;
+            if (team >= RR_SPATIAL_HASH_TEAM_COUNT)
+                continue;
+            ++starts[c * RR_SPATIAL_HASH_TEAM_COUNT + team + 1];
+            ++total;
+        }
+    }
+    for (uint32_t i = 1; i <= cell_count * RR_SPATIAL_HASH_TEAM_COUNT; ++i)
+        starts[i] += starts[i - 1];
+    if (total > this->targets_capacity)
+    {
+        this->targets_capacity = total * 2;
+        this->targets = realloc(this->targets,
+                                this->targets_capacity * sizeof *this->targets);
+    }
+    // starts[i] doubles as the write cursor of bucket i and ends up at the
+    // end of it, shifting everything up by one turns the ends back into starts
+    for (uint32_t c = 0; c < cell_count; ++c)
+    {
+        struct rr_spatial_hash_cell *cell = &this->cells[c];
+        for (uint32_t i = 0; i < cell->entities_in_use; ++i)
+        {
+            EntityIdx entity = cell->entities[i];
+            if (!is_target(this->simulation, entity))
+                continue;
+            uint8_t team =
+                rr_simulation_get_relations(this->simulation, entity)->team;
+            if (team >= RR_SPATIAL_HASH_TEAM_COUNT)
+                continue;
+            this->targets[starts[c * RR_SPATIAL_HASH_TEAM_COUNT + team]++] =
+                entity;
+        }
+    }
+    for (uint32_t i = cell_count * RR_SPATIAL_HASH_TEAM_COUNT; i > 0; --i)
+        starts[i] = starts[i - 1];
+    starts[0] = 0;
+    this->targets_valid = 1;
+}
+
+void rr_spatial_hash_query_enemies(struct rr_spatial_hash *this, float fx,
+                                   float fy, float fw, float fh, uint8_t team,
+                                   void *user_captures,
+                                   void (*cb)(EntityIdx, void *))
+{
+    if (!this->targets_valid)
+        build_targets(this);
+    uint32_t s_x, s_y, e_x, e_y;
+    query_bounds(this, fx, fy, fw, fh, &s_x, &s_y, &e_x, &e_y);
+
+    for (uint32_t y = s_y; y <= e_y; y++)
+        for (uint32_t x = s_x; x <= e_x; x++)
+        {
+            uint32_t *starts = &this->target_starts[(x * this->size + y) *
+                                                    RR_SPATIAL_HASH_TEAM_COUNT];
+            for (uint8_t t = 0; t < RR_SPATIAL_HASH_TEAM_COUNT; ++t)
+            {
+                if (t == team)
+                    continue;
+                for (uint32_t i = starts[t]; i < starts[t + 1]; ++i)
+                    cb(this->targets[i], user_captures);
+            }
+        }
+}
+
 void rr_spatial_hash_find_possible_collisions(
     struct rr_spatial_hash *this, void *user_captures,
     void (*cb)(struct rr_simulation *, EntityIdx, EntityIdx, void *))
@@ -143,4 +246,5 @@ void rr_spatial_hash_reset(struct rr_spatial_hash *this)
         for (uint64_t j = 0; j < this->size; j++)
             this->cells[i * this->size + j].entities_in_use = 0;
     // memset(&this->cells, 0, sizeof this->cells);
+    this->targets_valid = 0;
 }
\ No newline at end of file
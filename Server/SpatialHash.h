@@ -22,6 +22,7 @@
 #define RR_SPATIAL_HASH_GRID_LENGTH                                            \
     (((RR_ARENA_LENGTH + SPATIAL_HASH_GRID_SIZE - 1) / SPATIAL_HASH_GRID_SIZE))
 #define RR_SPATIAL_HASH_CELL_MAX_ENTITY_COUNT (2048)
+#define RR_SPATIAL_HASH_TEAM_COUNT (2)
 
 struct rr_simulation;
 
@@ -36,6 +37,13 @@ struct rr_spatial_hash
     struct rr_spatial_hash_cell *cells;
     struct rr_simulation *simulation;
     uint32_t size;
+    // flowers, mobs and seed petals of each cell grouped by team. built on
+    // the first target query after the hash is filled and shared by every
+    // aoe and targeting query until the next reset
+    EntityIdx *targets;
+    uint32_t *target_starts;
+    uint32_t targets_capacity;
+    uint8_t targets_valid;
 };
 
 void rr_spatial_hash_init(struct rr_spatial_hash *, struct rr_simulation *,
@@ -44,6 +52,10 @@ void rr_spatial_hash_insert(struct rr_spatial_hash *, EntityIdx);
 void rr_spatial_hash_update(struct rr_spatial_hash *, EntityIdx);
 void rr_spatial_hash_query(struct rr_spatial_hash *, float, float, float, float,
                            void *, void (*)(EntityIdx, void *));
+// like query but only visits targets that are not on the given team
+void rr_spatial_hash_query_enemies(struct rr_spatial_hash *, float, float,
+                                   float, float, uint8_t, void *,
+                                   void (*)(EntityIdx, void *));
 void rr_spatial_hash_find_possible_collisions(struct rr_spatial_hash *, void *,
                                               void (*)(struct rr_simulation *,
                                                        EntityIdx, EntityIdx,
@@ -19,15 +19,62 @@
 #include <string.h>
 
 #include <Server/Server.h>
+#include <Shared/Random.h>
+
+static uint8_t *squad_code_bucket(struct rr_server *server, char const *code)
+{
+    // fnv-1a
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < 6; ++i)
+        hash = (hash ^ (uint8_t)code[i]) * 16777619u;
+    return &server->squad_code_buckets[hash % RR_SQUAD_CODE_BUCKET_COUNT];
+}
+
+static uint8_t squad_code_find(struct rr_server *server, char const *code)
+{
+    uint8_t at = *squad_code_bucket(server, code);
+    for (; at != 0; at = server->squads[at - 1].next_in_code_bucket)
+        if (memcmp(server->squads[at - 1].squad_code, code, 6) == 0)
+            return at - 1;
+    return RR_ERROR_CODE_INVALID_SQUAD;
+}
+
+static void squad_code_remove(struct rr_server *server, uint8_t pos)
+{
+    uint8_t *link = squad_code_bucket(server, server->squads[pos].squad_code);
+    while (*link != 0 && *link != pos + 1)
+        link = &server->squads[*link - 1].next_in_code_bucket;
+    if (*link != 0)
+        *link = server->squads[pos].next_in_code_bucket;
+}
 
 void rr_squad_init(struct rr_squad *this, struct rr_server *server, uint8_t pos)
 {
+    squad_code_remove(server, pos);
     memset(this, 0, sizeof *this);
-    for (uint32_t i = 0; i < 6; ++i)
-        this->squad_code[i] = (char)(97 + rand() % 26);
+    // codes are unique so a lookup never has to pick between squads
+    do
+    {
+        for (uint32_t i = 0; i < 6; ++i)
+            this->squad_code[i] = (char)(97 + RR_RAND_BELOW(misc, 26));
+    } while (squad_code_find(server, this->squad_code) !=
+             RR_ERROR_CODE_INVALID_SQUAD);
     this->squad_code[6] = 0;
+    uint8_t *bucket = squad_code_bucket(server, this->squad_code);
+    this->next_in_code_bucket = *bucket;
+    *bucket = pos + 1;
     for (uint32_t i = 0; i < RR_MAX_CLIENT_COUNT; ++i)
         rr_bitset_unset(server->clients[i].joined_squad_before, pos);
+    rr_squad_changed(server, pos);
+}
+
+void rr_squad_changed(struct rr_server *this, uint8_t pos)
+{
+    struct rr_squad *squad = &this->squads[pos];
+    rr_bitset_maybe_set(this->open_squads, pos,
+                        rr_squad_has_space(squad) && !squad->private);
+    rr_bitset_set(this->dirty_squads, pos);
+    squad->version = ++this->squad_version;
 }
 
 uint8_t rr_squad_has_space(struct rr_squad *this)
@@ -67,12 +114,13 @@ void rr_squad_remove_client(struct rr_squad *this,
 uint8_t rr_client_find_squad(struct rr_server *this,
                              struct rr_server_client *member)
 {
-    for (uint8_t i = 0; i < RR_SQUAD_COUNT; ++i)
-        if (rr_squad_has_space(&this->squads[i]) && !this->squads[i].private &&
-            !rr_bitset_get(member->joined_squad_before, i))
-        {
-            return i;
-        }
+    for (uint32_t i = 0; i < RR_BITSET_ROUND(RR_SQUAD_COUNT); ++i)
+    {
+        uint8_t candidates =
+            this->open_squads[i] & ~member->joined_squad_before[i];
+        if (candidates != 0)
+            return i * 8 + __builtin_ctz(candidates);
+    }
     return RR_ERROR_CODE_INVALID_SQUAD;
 }
 
@@ -83,6 +131,7 @@ uint8_t rr_client_create_squad(struct rr_server *this,
         if (this->squads[i].member_count == 0)
         {
             this->squads[i].private = 1;
+            rr_squad_changed(this, i);
             return i;
         }
     return RR_ERROR_CODE_INVALID_SQUAD;
@@ -90,12 +139,11 @@ uint8_t rr_client_create_squad(struct rr_server *this,
 
 uint8_t rr_client_join_squad_with_code(struct rr_server *this, char *code)
 {
-    for (uint8_t i = 0; i < RR_SQUAD_COUNT; ++i)
-        if (memcmp(this->squads[i].squad_code, code, 6) == 0)
-            return rr_squad_has_space(&this->squads[i])
-                       ? i
-                       : RR_ERROR_CODE_FULL_SQUAD;
-    return RR_ERROR_CODE_INVALID_SQUAD;
+    uint8_t pos = squad_code_find(this, code);
+    if (pos == RR_ERROR_CODE_INVALID_SQUAD)
+        return pos;
+    return rr_squad_has_space(&this->squads[pos]) ? pos
+                                                  : RR_ERROR_CODE_FULL_SQUAD;
 }
 
 uint8_t rr_client_join_squad(struct rr_server *this,
@@ -107,6 +155,7 @@ uint8_t rr_client_join_squad(struct rr_server *this,
     member->squad = pos;
     member->in_squad = 1;
     rr_bitset_set(member->joined_squad_before, pos);
+    rr_squad_changed(this, pos);
     return 1;
 }
 
@@ -115,7 +164,9 @@ void rr_client_leave_squad(struct rr_server *this,
 {
     if (!member->in_squad)
         return;
-    rr_squad_remove_client(&this->squads[member->squad], member);
+    uint8_t pos = member->squad;
+    rr_squad_remove_client(&this->squads[pos], member);
+    rr_squad_changed(this, pos);
     member->squad = 0;
     member->in_squad = 0;
 }
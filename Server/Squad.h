@@ -24,6 +24,8 @@
 #define RR_ERROR_CODE_INVALID_SQUAD 255
 #define RR_ERROR_CODE_FULL_SQUAD 254
 
+#define RR_SQUAD_CODE_BUCKET_COUNT 128
+
 struct rr_server_client;
 struct rr_server;
 
@@ -32,7 +34,11 @@ struct rr_squad
     struct rr_squad_member members[RR_SQUAD_MEMBER_COUNT];
     uint8_t member_count;
     uint8_t private;
+    // next squad (plus one) in the same code bucket, 0 ends the chain
+    uint8_t next_in_code_bucket;
     char squad_code[7];
+    // unique across the server, taken from rr_server::squad_version
+    uint32_t version;
 };
 
 void rr_squad_init(struct rr_squad *, struct rr_server *, uint8_t);
@@ -17,36 +17,55 @@
 
 #include <Server/Simulation.h>
 
+#include <math.h>
 #include <stdio.h>
 
 #include <Shared/Entity.h>
-#include <Shared/Vector.h>
 
-void rr_system_centipede_foreach_function(EntityIdx id, void *simulation)
+// walks the chain from the head in one pass. segments that already sit at
+// the right distance from their parent only get their position carried
+// forward, the rest are snapped with a single sqrt and no atan2 unless they
+// actually moved
+void rr_system_centipede_foreach_function(EntityIdx id, void *_simulation)
 {
+    struct rr_simulation *simulation = _simulation;
     struct rr_component_centipede *centipede =
         rr_simulation_get_centipede(simulation, id);
-    struct rr_component_physical *physical =
-        rr_simulation_get_physical(simulation, id);
-    struct rr_vector parent_vector = {physical->x, physical->y};
     if (centipede->parent_node != RR_NULL_ENTITY)
         return;
+    struct rr_component_physical *physical =
+        rr_simulation_get_physical(simulation, id);
+    float parent_x = physical->x;
+    float parent_y = physical->y;
+    float parent_radius = physical->radius;
     while (centipede->child_node != RR_NULL_ENTITY)
     {
-        float radius = physical->radius;
         centipede =
             rr_simulation_get_centipede(simulation, centipede->child_node);
         physical = rr_simulation_get_physical(simulation, centipede->parent_id);
-        struct rr_vector delta = {physical->x - parent_vector.x,
-                                  physical->y - parent_vector.y};
-        if (delta.x == 0.0f && delta.y == 0.0f)
-            delta.x = 1.0f;
-
-        rr_vector_set_magnitude(&delta, radius + physical->radius + 0.01f);
-        rr_component_physical_set_x(physical, parent_vector.x + delta.x);
-        rr_component_physical_set_y(physical, parent_vector.y + delta.y);
-        rr_component_physical_set_angle(physical, rr_vector_theta(&delta));
-        rr_vector_set(&parent_vector, physical->x, physical->y);
+        float target = parent_radius + physical->radius + 0.01f;
+        float dx = physical->x - parent_x;
+        float dy = physical->y - parent_y;
+        float length_squared = dx * dx + dy * dy;
+        float target_squared = target * target;
+        if (fabsf(length_squared - target_squared) > target_squared * 1e-4f)
+        {
+            if (length_squared == 0)
+            {
+                dx = 1;
+                dy = 0;
+                length_squared = 1;
+            }
+            float scale = target / sqrtf(length_squared);
+            dx *= scale;
+            dy *= scale;
+            rr_component_physical_set_x(physical, parent_x + dx);
+            rr_component_physical_set_y(physical, parent_y + dy);
+            rr_component_physical_set_angle(physical, atan2f(dy, dx));
+        }
+        parent_x = physical->x;
+        parent_y = physical->y;
+        parent_radius = physical->radius;
     }
 }
 
@@ -94,6 +94,10 @@ static void grid_filter_candidates(struct rr_simulation *this,
         rr_simulation_get_physical(this, entity1);
     struct rr_component_physical *physical2 =
         rr_simulation_get_physical(this, entity2);
+    // neither moved under the velocity system since they last had no
+    // contacts, anything moved by setting its position never sleeps
+    if (physical1->sleeping && physical2->sleeping)
+        return;
     if (!should_entities_collide(this, entity1, entity2))
         return;
     struct rr_vector delta = {physical1->x - physical2->x,
@@ -102,6 +106,8 @@ static void grid_filter_candidates(struct rr_simulation *this,
     if ((delta.x * delta.x + delta.y * delta.y) <
         collision_radius * collision_radius)
     {
+        physical1->sleeping = physical1->still_ticks = 0;
+        physical2->sleeping = physical2->still_ticks = 0;
 #ifndef RIVET_BUILD
         if (physical1->colliding_with_size >= RR_MAX_COLLISION_COUNT)
             puts("entity cram limit exceeded");
@@ -87,6 +87,7 @@ static void enter_arena(struct rr_simulation *this, EntityIdx arena,
         physical, respawn_zone->y + 2 * a->maze->grid_size * rr_frand());
     rr_vector_set(&physical->velocity, 0, 0);
     rr_vector_set(&physical->collision_velocity, 0, 0);
+    physical->sleeping = physical->still_ticks = 0;
     a->first_squad_to_enter = player_info->squad;
     a->player_entered = 1;
 }
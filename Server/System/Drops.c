@@ -12,65 +12,40 @@
 
 // You should have received a copy of the GNU Affero General Public License
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
-
 #include <Server/System/System.h>
 
+#include <math.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <Server/Simulation.h>
 
-struct drop_pick_up_captures
+// drops are bucketed into a coarse grid every tick so each flower only looks
+// at the drops around it instead of every drop in the world
+#define DROP_GRID_CELL_SIZE (256)
+#define DROP_GRID_BUCKET_COUNT (1024)
+
+struct drop_grid
 {
+    EntityIdx heads[DROP_GRID_BUCKET_COUNT];
+    EntityIdx next[RR_MAX_ENTITY_COUNT];
+    EntityIdx candidates[RR_MAX_ENTITY_COUNT];
     struct rr_simulation *simulation;
-    EntityIdx self;
+    float max_radius;
 };
 
-static void drop_pick_up(EntityIdx entity, void *_captures)
-{
-    struct drop_pick_up_captures *captures = _captures;
-    struct rr_simulation *this = captures->simulation;
-    EntityIdx drop_id = captures->self;
-    struct rr_component_drop *drop = rr_simulation_get_drop(this, drop_id);
-
-    struct rr_component_relations *flower_relations =
-        rr_simulation_get_relations(this, entity);
-    if (!rr_simulation_entity_alive(this, flower_relations->owner))
-        return;
-
-    struct rr_component_player_info *player_info =
-        rr_simulation_get_player_info(this, flower_relations->owner);
-    if (!rr_bitset_get(drop->can_be_picked_up_by, player_info->squad))
-        return;
-    if (rr_bitset_get(drop->picked_up_by,
-                      player_info->squad * RR_SQUAD_MEMBER_COUNT +
-                          player_info->squad_pos))
-        return;
-    struct rr_component_physical *physical =
-        rr_simulation_get_physical(this, drop_id);
+static struct drop_grid grid;
 
-    struct rr_component_physical *flower_physical =
-        rr_simulation_get_physical(this, entity);
+static uint32_t drop_grid_bucket(EntityIdx arena, int32_t x, int32_t y)
+{
+    uint32_t hash = (uint32_t)x * 73856093u ^ (uint32_t)y * 19349663u ^
+                    (uint32_t)arena * 83492791u;
+    return hash & (DROP_GRID_BUCKET_COUNT - 1);
+}
 
-    struct rr_vector delta = {physical->x - flower_physical->x,
-                              physical->y - flower_physical->y};
-    if (rr_vector_magnitude_cmp(
-            &delta,
-            physical->radius + player_info->modifiers.drop_pickup_radius) == 1)
-        return;
-    if (player_info->drops_this_tick_size >= 8)
-        return;
-    rr_bitset_set(drop->picked_up_by,
-                  player_info->squad * RR_SQUAD_MEMBER_COUNT +
-                      player_info->squad_pos);
-
-    ++player_info
-          ->collected_this_run[drop->id * rr_rarity_id_max + drop->rarity];
-    rr_component_player_info_set_update_loot(player_info);
-    player_info->drops_this_tick[player_info->drops_this_tick_size].id =
-        drop->id;
-    player_info->drops_this_tick[player_info->drops_this_tick_size].rarity =
-        drop->rarity;
-    ++player_info->drops_this_tick_size;
+static int32_t drop_grid_cell(float coord)
+{
+    return (int32_t)floorf(coord / DROP_GRID_CELL_SIZE);
 }
 
 static void drop_despawn_tick(EntityIdx entity, void *_captures)
@@ -87,13 +62,124 @@ static void drop_despawn_tick(EntityIdx entity, void *_captures)
     --drop->ticks_until_despawn;
     if (drop->ticks_until_despawn > 25 * 10 * (drop->rarity + 1) - 10)
         return;
-    struct drop_pick_up_captures captures;
-    captures.self = entity;
-    captures.simulation = this;
-    rr_simulation_for_each_flower(this, &captures, drop_pick_up);
+    uint32_t bucket =
+        drop_grid_bucket(physical->arena, drop_grid_cell(physical->x),
+                         drop_grid_cell(physical->y));
+    grid.next[entity] = grid.heads[bucket];
+    grid.heads[bucket] = entity;
+    if (physical->radius > grid.max_radius)
+        grid.max_radius = physical->radius;
+}
+
+static int drop_urgency_compare(void const *_a, void const *_b)
+{
+    struct rr_component_drop *a =
+        rr_simulation_get_drop(grid.simulation, *(EntityIdx const *)_a);
+    struct rr_component_drop *b =
+        rr_simulation_get_drop(grid.simulation, *(EntityIdx const *)_b);
+    return a->ticks_until_despawn - b->ticks_until_despawn;
+}
+
+static int drop_try_collect(struct rr_component_player_info *player_info,
+                            struct rr_component_drop *drop)
+{
+    // identical drops share a slot, so the per tick limit only applies to
+    // distinct id and rarity pairs
+    for (uint32_t i = 0; i < player_info->drops_this_tick_size; ++i)
+    {
+        struct rr_drop_pickup *slot = &player_info->drops_this_tick[i];
+        if (slot->id != drop->id || slot->rarity != drop->rarity ||
+            slot->count == 255)
+            continue;
+        ++slot->count;
+        return 1;
+    }
+    if (player_info->drops_this_tick_size >= RR_MAX_DROPS_PER_TICK)
+        return 0;
+    struct rr_drop_pickup *slot =
+        &player_info->drops_this_tick[player_info->drops_this_tick_size++];
+    slot->id = drop->id;
+    slot->rarity = drop->rarity;
+    slot->count = 1;
+    return 1;
+}
+
+static void flower_pick_up_drops(EntityIdx flower, void *_captures)
+{
+    struct rr_simulation *this = _captures;
+    struct rr_component_relations *flower_relations =
+        rr_simulation_get_relations(this, flower);
+    if (!rr_simulation_entity_alive(this, flower_relations->owner))
+        return;
+    struct rr_component_player_info *player_info =
+        rr_simulation_get_player_info(this, flower_relations->owner);
+    struct rr_component_physical *flower_physical =
+        rr_simulation_get_physical(this, flower);
+    uint32_t picked_bit =
+        player_info->squad * RR_SQUAD_MEMBER_COUNT + player_info->squad_pos;
+    float pickup_radius = player_info->modifiers.drop_pickup_radius;
+    float reach = pickup_radius + grid.max_radius;
+
+    int32_t min_x = drop_grid_cell(flower_physical->x - reach);
+    int32_t max_x = drop_grid_cell(flower_physical->x + reach);
+    int32_t min_y = drop_grid_cell(flower_physical->y - reach);
+    int32_t max_y = drop_grid_cell(flower_physical->y + reach);
+    uint32_t candidate_count = 0;
+    for (int32_t x = min_x; x <= max_x; ++x)
+        for (int32_t y = min_y; y <= max_y; ++y)
+        {
+            EntityIdx entity = grid.heads[drop_grid_bucket(
+                flower_physical->arena, x, y)];
+            for (; entity != RR_NULL_ENTITY; entity = grid.next[entity])
+            {
+                struct rr_component_drop *drop =
+                    rr_simulation_get_drop(this, entity);
+                struct rr_component_physical *physical =
+                    rr_simulation_get_physical(this, entity);
+                if (physical->arena != flower_physical->arena)
+                    continue;
+                if (!rr_bitset_get(drop->can_be_picked_up_by,
+                                   player_info->squad))
+                    continue;
+                // also guards against a bucket being visited twice
+                if (rr_bitset_get(drop->picked_up_by, picked_bit))
+                    continue;
+                struct rr_vector delta = {physical->x - flower_physical->x,
+                                          physical->y - flower_physical->y};
+                if (rr_vector_magnitude_cmp(
+                        &delta, physical->radius + pickup_radius) == 1)
+                    continue;
+                rr_bitset_set(drop->picked_up_by, picked_bit);
+                grid.candidates[candidate_count++] = entity;
+            }
+        }
+    if (candidate_count == 0)
+        return;
+
+    // drops closest to despawning get collected first. anything that doesn't
+    // fit waits for the next tick
+    qsort(grid.candidates, candidate_count, sizeof *grid.candidates,
+          drop_urgency_compare);
+    for (uint32_t i = 0; i < candidate_count; ++i)
+    {
+        struct rr_component_drop *drop =
+            rr_simulation_get_drop(this, grid.candidates[i]);
+        if (!drop_try_collect(player_info, drop))
+        {
+            rr_bitset_unset(drop->picked_up_by, picked_bit);
+            continue;
+        }
+        ++player_info
+              ->collected_this_run[drop->id * rr_rarity_id_max + drop->rarity];
+        rr_component_player_info_set_update_loot(player_info);
+    }
 }
 
 void rr_system_drops_tick(struct rr_simulation *this)
 {
+    memset(grid.heads, 0, sizeof grid.heads);
+    grid.simulation = this;
+    grid.max_radius = 0;
     rr_simulation_for_each_drop(this, this, drop_despawn_tick);
+    rr_simulation_for_each_flower(this, this, flower_pick_up_drops);
 }
@@ -88,14 +88,11 @@ static void lightning_petal_system(struct rr_simulation *simulation,
         rr_simulation_get_physical(simulation, first);
     struct rr_component_relations *relations =
         rr_simulation_get_relations(simulation, petal->parent_id);
-    struct rr_simulation_animation *animation =
-        &simulation->animations[simulation->animation_length++];
-    animation->type = rr_animation_type_lightningbolt;
     EntityIdx chain[16] = {petal->parent_id, first};
-    animation->points[0].x = petal_physical->x;
-    animation->points[0].y = petal_physical->y;
-    animation->points[1].x = first_physical->x;
-    animation->points[1].y = first_physical->y;
+    // damage numbers are animations too, so the bolt is only added once the
+    // chain is done or the array could move under it
+    struct rr_vector points[16] = {{petal_physical->x, petal_physical->y},
+                                   {first_physical->x, first_physical->y}};
     uint32_t chain_amount = petal->rarity + 1;
     float damage =
         rr_simulation_get_health(simulation, petal->parent_id)->damage * 0.5;
@@ -125,12 +122,16 @@ static void lightning_petal_system(struct rr_simulation *simulation,
         health->damage_paused = 5;
         physical->stun_ticks = 4;
         chain[captures.length] = target;
-        animation->points[captures.length].x = physical->x;
-        animation->points[captures.length].y = physical->y;
+        points[captures.length].x = physical->x;
+        points[captures.length].y = physical->y;
         captures.curr_x = physical->x;
         captures.curr_y = physical->y;
     }
+    struct rr_simulation_animation *animation = rr_simulation_add_animation(
+        simulation, rr_animation_type_lightningbolt);
+    animation->arena = petal_physical->arena;
     animation->length = captures.length;
+    memcpy(animation->points, points, captures.length * sizeof *points);
     rr_simulation_request_entity_deletion(simulation, petal->parent_id);
 }
 
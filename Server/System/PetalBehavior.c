@@ -17,6 +17,7 @@
 
 #include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #include <Server/EntityAllocation.h>
 #include <Server/EntityDetection.h>
@@ -37,6 +38,30 @@ struct uranium_captures
     float damage;
 };
 
+// reloads are bucketed by tick & (RELOAD_WHEEL_SIZE - 1), cooldowns longer
+// than the wheel just stay in their bucket for another lap
+#define RELOAD_WHEEL_SIZE (256)
+
+struct rr_petal_reload
+{
+    EntityHash player_info;
+    uint32_t tick;
+    uint8_t outer;
+    uint8_t inner;
+};
+
+struct rr_petal_reload_bucket
+{
+    struct rr_petal_reload *reloads;
+    uint32_t length;
+    uint32_t capacity;
+};
+
+struct rr_petal_reload_wheel
+{
+    struct rr_petal_reload_bucket buckets[RELOAD_WHEEL_SIZE];
+};
+
 #ifdef RIVET_BUILD
 #define URANIUM_RADIUS_FACTOR 1
 #else
@@ -49,9 +74,6 @@ static void uranium_damage(EntityIdx mob, void *_captures)
     struct rr_simulation *simulation = captures->simulation;
     if (!rr_simulation_has_mob(simulation, mob))
         return;
-    if (rr_simulation_get_relations(simulation, mob)->team ==
-        rr_simulation_get_relations(simulation, captures->flower_id)->team)
-        return;
     struct rr_component_health *health =
         rr_simulation_get_health(simulation, mob);
     struct rr_component_physical *physical =
@@ -90,12 +112,12 @@ static void uranium_petal_system(struct rr_simulation *simulation,
         struct uranium_captures captures = {simulation,    relations->owner,
                                             petal->rarity, physical->x,
                                             physical->y,   health->damage};
-        rr_spatial_hash_query(
+        rr_spatial_hash_query_enemies(
             &rr_simulation_get_arena(simulation, physical->arena)->spatial_hash,
             physical->x, physical->y,
             URANIUM_RADIUS_FACTOR * (100 + 75 * captures.petal_rarity),
             URANIUM_RADIUS_FACTOR * (100 + 75 * captures.petal_rarity),
-            &captures, uranium_damage);
+            relations->team, &captures, uranium_damage);
     }
 }
 
@@ -109,7 +131,8 @@ static void system_petal_detach(struct rr_simulation *simulation,
     struct rr_component_player_info_petal *ppetal =
         &player_info->slots[outer_pos].petals[inner_pos];
     ppetal->entity_hash = RR_NULL_ENTITY;
-    ppetal->cooldown_ticks = petal_data->cooldown;
+    ppetal->reload_tick = simulation->ticks + petal_data->cooldown;
+    ppetal->reload_scheduled = 0;
 }
 
 static EntityIdx squad_has_dead_player(struct rr_simulation *simulation,
@@ -168,19 +191,16 @@ static uint8_t is_close_enough_and_angle(struct rr_simulation *simulation,
 
 static void system_flower_petal_movement_logic(
     struct rr_simulation *simulation, EntityIdx id,
-    struct rr_component_player_info *player_info, uint32_t rotation_pos,
+    struct rr_component_player_info *player_info,
+    struct rr_component_physical *flower_physical, float curr_angle,
     uint32_t outer_pos, uint32_t inner_pos,
     struct rr_petal_data const *petal_data)
 {
     struct rr_component_petal *petal = rr_simulation_get_petal(simulation, id);
     struct rr_component_physical *physical =
         rr_simulation_get_physical(simulation, id);
-    struct rr_component_physical *flower_physical =
-        rr_simulation_get_physical(simulation, player_info->flower_id);
     struct rr_vector position_vector = {physical->x, physical->y};
     struct rr_vector flower_vector = {flower_physical->x, flower_physical->y};
-    float curr_angle = player_info->global_rotation +
-                       rotation_pos * 2 * M_PI / player_info->rotation_count;
 
     if (petal->effect_delay == 0)
     {
@@ -496,9 +516,99 @@ static void petal_modifiers(struct rr_simulation *simulation,
         to_rotate * ((rot_count % 3) ? (rot_count % 3 == 2) ? 0 : -1 : 1);
 }
 
+static void reload_petal(struct rr_simulation *simulation,
+                         struct rr_component_player_info *player_info,
+                         struct rr_component_player_info_petal_slot *slot,
+                         struct rr_component_player_info_petal *p_petal)
+{
+    struct rr_component_physical *flower_physical =
+        rr_simulation_get_physical(simulation, player_info->flower_id);
+    p_petal->entity_hash = rr_simulation_get_entity_hash(
+        simulation,
+        rr_simulation_alloc_petal(simulation, player_info->arena,
+                                  flower_physical->x, flower_physical->y,
+                                  slot->id, slot->rarity,
+                                  player_info->flower_id));
+}
+
+static void schedule_reload(struct rr_simulation *simulation,
+                            struct rr_component_player_info *player_info,
+                            uint32_t outer, uint32_t inner)
+{
+    if (simulation->petal_reloads == NULL)
+        simulation->petal_reloads =
+            calloc(1, sizeof *simulation->petal_reloads);
+    struct rr_component_player_info_petal *p_petal =
+        &player_info->slots[outer].petals[inner];
+    struct rr_petal_reload_bucket *bucket =
+        &simulation->petal_reloads
+             ->buckets[p_petal->reload_tick & (RELOAD_WHEEL_SIZE - 1)];
+    if (bucket->length == bucket->capacity)
+    {
+        bucket->capacity = bucket->capacity == 0 ? 16 : bucket->capacity * 2;
+        bucket->reloads = realloc(bucket->reloads,
+                                  bucket->capacity * sizeof *bucket->reloads);
+    }
+    struct rr_petal_reload *reload = &bucket->reloads[bucket->length++];
+    reload->player_info =
+        rr_simulation_get_entity_hash(simulation, player_info->parent_id);
+    reload->tick = p_petal->reload_tick;
+    reload->outer = outer;
+    reload->inner = inner;
+    p_petal->reload_scheduled = 1;
+    if (p_petal->reload_tick > player_info->slots[outer].reload_until)
+        player_info->slots[outer].reload_until = p_petal->reload_tick;
+}
+
+// a reload is stale if the petal was rescheduled (swapped, detached again)
+// since it was queued. those are dropped, the newer entry is still queued
+static void fire_reload(struct rr_simulation *simulation,
+                        struct rr_petal_reload *reload)
+{
+    if (!rr_simulation_entity_alive(simulation, reload->player_info))
+        return;
+    struct rr_component_player_info *player_info =
+        rr_simulation_get_player_info(simulation, reload->player_info);
+    if (reload->outer >= player_info->slot_count)
+        return;
+    struct rr_component_player_info_petal_slot *slot =
+        &player_info->slots[reload->outer];
+    if (reload->inner >= slot->count)
+        return;
+    struct rr_component_player_info_petal *p_petal =
+        &slot->petals[reload->inner];
+    if (!p_petal->reload_scheduled || p_petal->reload_tick != reload->tick ||
+        p_petal->entity_hash != RR_NULL_ENTITY)
+        return;
+    p_petal->reload_scheduled = 0;
+    // dead flowers get the petal back as soon as they respawn
+    if (!rr_simulation_entity_alive(simulation, player_info->flower_id))
+        return;
+    reload_petal(simulation, player_info, slot, p_petal);
+}
+
+static void petal_reload_wheel_tick(struct rr_simulation *simulation)
+{
+    if (simulation->petal_reloads == NULL)
+        return;
+    struct rr_petal_reload_bucket *bucket =
+        &simulation->petal_reloads
+             ->buckets[simulation->ticks & (RELOAD_WHEEL_SIZE - 1)];
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < bucket->length; ++i)
+    {
+        if (bucket->reloads[i].tick != simulation->ticks)
+            bucket->reloads[kept++] = bucket->reloads[i];
+        else
+            fire_reload(simulation, &bucket->reloads[i]);
+    }
+    bucket->length = kept;
+}
+
 static void rr_system_petal_reload_foreach_function(EntityIdx id,
-                                                    void *simulation)
+                                                    void *_simulation)
 {
+    struct rr_simulation *simulation = _simulation;
     struct rr_component_player_info *player_info =
         rr_simulation_get_player_info(simulation, id);
     if (!rr_simulation_entity_alive(simulation, player_info->flower_id))
@@ -507,12 +617,13 @@ static void rr_system_petal_reload_foreach_function(EntityIdx id,
         rr_simulation_get_physical(simulation, player_info->flower_id);
     petal_modifiers(simulation, player_info);
     uint32_t rotation_pos = 0;
+    float rotation_step = 2 * M_PI / player_info->rotation_count;
     for (uint64_t outer = 0; outer < player_info->slot_count; ++outer)
     {
         struct rr_component_player_info_petal_slot *slot =
             &player_info->slots[outer];
         struct rr_petal_data const *data = &RR_PETAL_DATA[slot->id];
-        uint8_t max_cd = 0;
+        uint32_t waiting = 0;
         slot->count = slot->id == rr_petal_id_peas
                           ? 1
                           : RR_PETAL_DATA[slot->id].count[slot->rarity];
@@ -526,21 +637,23 @@ static void rr_system_petal_reload_foreach_function(EntityIdx id,
                 !rr_simulation_entity_alive(simulation, p_petal->entity_hash))
             {
                 p_petal->entity_hash = RR_NULL_ENTITY;
-                p_petal->cooldown_ticks = data->cooldown;
+                p_petal->reload_tick = simulation->ticks + data->cooldown;
+                p_petal->reload_scheduled = 0;
             }
             if (p_petal->entity_hash == RR_NULL_ENTITY)
             {
-                float cd = rr_fclamp(
-                    255.0f * p_petal->cooldown_ticks / data->cooldown, 0, 255);
-                if (cd > max_cd)
-                    max_cd = cd;
-                if (--p_petal->cooldown_ticks <= 0)
-                    p_petal->entity_hash = rr_simulation_get_entity_hash(
-                        simulation,
-                        rr_simulation_alloc_petal(
-                            simulation, player_info->arena, flower_physical->x,
-                            flower_physical->y, slot->id, slot->rarity,
-                            player_info->flower_id));
+                // queued petals are left to the wheel, this only picks up
+                // ones that were just lost, swapped in or outlived their
+                // flower
+                if (p_petal->reload_scheduled)
+                    ++waiting;
+                else if (p_petal->reload_tick <= simulation->ticks)
+                    reload_petal(simulation, player_info, slot, p_petal);
+                else
+                {
+                    schedule_reload(simulation, player_info, outer, inner);
+                    ++waiting;
+                }
             }
             else
             {
@@ -559,7 +672,10 @@ static void rr_system_petal_reload_foreach_function(EntityIdx id,
                 }
                 system_flower_petal_movement_logic(
                     simulation, p_petal->entity_hash, player_info,
-                    rotation_pos - 1, outer, inner, data);
+                    flower_physical,
+                    player_info->global_rotation +
+                        (rotation_pos - 1) * rotation_step,
+                    outer, inner, data);
                 if (data->id == rr_petal_id_egg)
                 {
                     struct rr_component_petal *petal = rr_simulation_get_petal(
@@ -601,7 +717,12 @@ static void rr_system_petal_reload_foreach_function(EntityIdx id,
                 }
             }
         }
-        rr_component_player_info_set_slot_cd(player_info, outer, max_cd);
+        uint32_t remaining = 0;
+        if (waiting && slot->reload_until > simulation->ticks)
+            remaining = slot->reload_until - simulation->ticks;
+        rr_component_player_info_set_slot_cd(
+            player_info, outer,
+            rr_fclamp(255.0f * remaining / data->cooldown, 0, 255));
     }
     player_info->rotation_count = rotation_pos;
 }
@@ -680,6 +801,7 @@ static void system_petal_misc_logic(EntityIdx id, void *_simulation)
 
 void rr_system_petal_behavior_tick(struct rr_simulation *simulation)
 {
+    petal_reload_wheel_tick(simulation);
     rr_simulation_for_each_player_info(simulation, simulation,
                                        rr_system_petal_reload_foreach_function);
     rr_simulation_for_each_petal(simulation, simulation,
@@ -209,10 +209,42 @@ static uint32_t min_of_4(float *arr)
     return min;
 }
 
-static void system_velocity(EntityIdx id, void *simulation)
+#define SLEEP_TICKS (25)
+#define SLEEP_SPEED (0.01f)
+
+// centipede bodies get no acceleration of their own but are dragged around
+// by the centipede system setting their position, so they never rest
+static uint8_t is_resting(struct rr_simulation *simulation, EntityIdx id,
+                          struct rr_component_physical *physical)
 {
+    if (rr_simulation_has_centipede(simulation, id) &&
+        rr_simulation_get_centipede(simulation, id)->parent_node !=
+            RR_NULL_ENTITY)
+        return 0;
+    return physical->acceleration.x == 0 && physical->acceleration.y == 0 &&
+           physical->collision_velocity.x == 0 &&
+           physical->collision_velocity.y == 0 && physical->stun_ticks == 0 &&
+           fabsf(physical->velocity.x) < SLEEP_SPEED &&
+           fabsf(physical->velocity.y) < SLEEP_SPEED;
+}
+
+static void system_velocity(EntityIdx id, void *_simulation)
+{
+    struct rr_simulation *simulation = _simulation;
     struct rr_component_physical *physical =
         rr_simulation_get_physical(simulation, id);
+    // anything pushing it or a new contact (see collision detection) wakes it
+    if (!is_resting(simulation, id, physical))
+        physical->sleeping = physical->still_ticks = 0;
+    else if (physical->sleeping || ++physical->still_ticks >= SLEEP_TICKS)
+    {
+        physical->sleeping = 1;
+        rr_vector_set(&physical->velocity, 0, 0);
+        rr_vector_set(&physical->wall_collision, 0, 0);
+        physical->acceleration_scale = physical->web_slowdown = 1;
+        ++simulation->sleeping_count;
+        return;
+    }
     rr_vector_scale(&physical->velocity, physical->friction);
     physical->acceleration_scale *=
         rr_lerp(physical->web_slowdown, 1, physical->slow_resist);
@@ -263,6 +295,14 @@ static void system_velocity(EntityIdx id, void *simulation)
         rr_component_physical_set_y(physical, before_y + vel.y);
         return;
     }
+    // nothing the tile checks below could push is within reach this tick
+    if (rr_maze_clearance(arena->maze, before_x, before_y) >
+        physical->radius + rr_vector_get_magnitude(&vel))
+    {
+        rr_component_physical_set_x(physical, now_x);
+        rr_component_physical_set_y(physical, now_y);
+        return;
+    }
     int32_t before_grid_x = floorf(before_x / arena->maze->grid_size);
     int32_t now_grid_x = floorf(now_x / arena->maze->grid_size);
     int32_t before_grid_y = floorf(before_y / arena->maze->grid_size);
@@ -369,5 +409,6 @@ static void system_velocity(EntityIdx id, void *simulation)
 
 void rr_system_velocity_tick(struct rr_simulation *simulation)
 {
+    simulation->sleeping_count = 0;
     rr_simulation_for_each_physical(simulation, simulation, system_velocity);
 }
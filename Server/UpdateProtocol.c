@@ -35,6 +35,7 @@ struct rr_protocol_for_each_function_captures
     struct proto_bug *encoder;
     struct rr_component_player_info *player_info;
     uint8_t *entities_in_view;
+    uint8_t *entered_view;
 };
 
 static void rr_simulation_write_entity_function(uint64_t _id, void *_captures)
@@ -44,17 +45,10 @@ static void rr_simulation_write_entity_function(uint64_t _id, void *_captures)
     struct rr_simulation *simulation = captures->simulation;
     struct proto_bug *encoder = captures->encoder;
     struct rr_component_player_info *player_info = captures->player_info;
-    uint8_t *new_entities_in_view = captures->entities_in_view;
 
     proto_bug_write_varuint(encoder, id, "entity update id");
 
-    uint8_t is_creation = 0;
-
-    if (!rr_bitset_get_bit(player_info->entities_in_view, id))
-    {
-        is_creation = 1;
-        rr_bitset_set(player_info->entities_in_view, id);
-    }
+    uint8_t is_creation = rr_bitset_get(captures->entered_view, id);
 
     uint32_t component_flags = simulation->entity_tracker[id];
     proto_bug_write_uint8(encoder, is_creation, "upcreate");
@@ -152,33 +146,25 @@ static void rr_simulation_write_entity_deletions_function(uint64_t _id,
     struct rr_protocol_for_each_function_captures *captures = _captures;
     struct rr_component_player_info *player_info = captures->player_info;
     struct proto_bug *encoder = captures->encoder;
-    uint8_t *new_entities_in_view = captures->entities_in_view;
 
-    if (!rr_bitset_get_bit(new_entities_in_view, id))
+    uint8_t serverside_delete = !entity_alive(captures->simulation, id);
+    if (serverside_delete == 0)
     {
-        // deletion spotted!
-        uint8_t serverside_delete = !entity_alive(captures->simulation, id);
-        if (serverside_delete == 0)
+        if (rr_simulation_has_drop(captures->simulation, id))
         {
-            if (rr_simulation_has_drop(captures->simulation, id))
-            {
-                struct rr_component_drop *drop =
-                    rr_simulation_get_drop(captures->simulation, id);
-                if (!rr_bitset_get(drop->can_be_picked_up_by,
-                                   player_info->squad))
-                    serverside_delete = 1;
-                else if (rr_bitset_get(drop->picked_up_by,
-                                       player_info->squad *
-                                               RR_SQUAD_MEMBER_COUNT +
-                                           player_info->squad_pos))
-                    // 1 = in-place deletion, 2 = suck to player
-                    serverside_delete = 2;
-            }
+            struct rr_component_drop *drop =
+                rr_simulation_get_drop(captures->simulation, id);
+            if (!rr_bitset_get(drop->can_be_picked_up_by, player_info->squad))
+                serverside_delete = 1;
+            else if (rr_bitset_get(drop->picked_up_by,
+                                   player_info->squad * RR_SQUAD_MEMBER_COUNT +
+                                       player_info->squad_pos))
+                // 1 = in-place deletion, 2 = suck to player
+                serverside_delete = 2;
         }
-        rr_bitset_unset(player_info->entities_in_view, id);
-        proto_bug_write_varuint(encoder, id, "entity deletion id");
-        proto_bug_write_uint8(encoder, serverside_delete, "deletion type");
     }
+    proto_bug_write_varuint(encoder, id, "entity deletion id");
+    proto_bug_write_uint8(encoder, serverside_delete, "deletion type");
 }
 
 void rr_simulation_write_binary(struct rr_simulation *this,
@@ -204,15 +190,23 @@ void rr_simulation_write_binary(struct rr_simulation *this,
             rr_bitset_set(new_entities_in_view, (EntityIdx)p_info->flower_id);
     }
 
+    // what entered and left the view since the last update, in one pass
+    uint8_t entered_view[RR_BITSET_ROUND(RR_MAX_ENTITY_COUNT)];
+    uint8_t left_view[RR_BITSET_ROUND(RR_MAX_ENTITY_COUNT)];
+    rr_bitset_diff(entered_view, left_view, player_info->entities_in_view,
+                   new_entities_in_view, RR_BITSET_ROUND(RR_MAX_ENTITY_COUNT));
+    memcpy(player_info->entities_in_view, new_entities_in_view,
+           RR_BITSET_ROUND(RR_MAX_ENTITY_COUNT));
+
     struct rr_protocol_for_each_function_captures captures;
     captures.simulation = this;
     captures.encoder = encoder;
     captures.player_info = player_info;
     captures.entities_in_view = new_entities_in_view;
+    captures.entered_view = entered_view;
 
-    rr_bitset_for_each_bit(&player_info->entities_in_view[0],
-                           &player_info->entities_in_view[0] +
-                               (RR_BITSET_ROUND(RR_MAX_ENTITY_COUNT)),
+    rr_bitset_for_each_bit(left_view,
+                           left_view + RR_BITSET_ROUND(RR_MAX_ENTITY_COUNT),
                            &captures,
                            rr_simulation_write_entity_deletions_function);
     proto_bug_write_varuint(
@@ -19,6 +19,7 @@
 #include <stdlib.h>
 
 #include <Server/Simulation.h>
+#include <Shared/Random.h>
 #include <Shared/StaticData.h>
 #include <Shared/Utilities.h>
 
@@ -26,28 +27,33 @@ uint32_t get_spawn_rarity(float difficulty)
 {
     if (difficulty < 1)
         difficulty = 1;
-    double rarity_seed = rr_frand();
+    double rarity_seed = RR_FRAND(spawn);
     uint32_t rarity_cap = rr_rarity_id_common + (difficulty + 7) / 8;
     if (rarity_cap > rr_rarity_id_ultimate)
         rarity_cap = rr_rarity_id_ultimate;
     uint32_t rarity = rarity_cap >= 2 ? rarity_cap - 2 : 0;
-    for (; rarity < rarity_cap; ++rarity)
-        if (pow(1 - (1 - RR_MOB_WAVE_RARITY_COEFFICIENTS[rarity + 1]) * 0.3,
-                pow(1.5, difficulty)) >= rarity_seed)
-            break;
-    return rarity;
+    // blend the two rows around the difficulty instead of snapping to one
+    double position = difficulty * RR_SPAWN_DIFFICULTY_STEPS;
+    uint32_t row = position;
+    double t = position - row;
+    if (row >= RR_SPAWN_DIFFICULTY_MAX * RR_SPAWN_DIFFICULTY_STEPS)
+    {
+        row = RR_SPAWN_DIFFICULTY_MAX * RR_SPAWN_DIFFICULTY_STEPS - 1;
+        t = 1;
+    }
+    double thresholds[rr_rarity_id_max];
+    for (uint32_t i = rarity; i < rarity_cap; ++i)
+        thresholds[i] = RR_SPAWN_RARITY_TABLE[row][i] * (1 - t) +
+                        RR_SPAWN_RARITY_TABLE[row + 1][i] * t;
+    return rarity + rr_lower_bound(thresholds + rarity, rarity_cap - rarity,
+                                   rarity_seed);
 }
 
 uint8_t get_spawn_id(uint8_t biome, struct rr_maze_grid *zone)
 {
     double *table = biome == 0 ? RR_HELL_CREEK_MOB_ID_RARITY_COEFFICIENTS
                                : RR_GARDEN_MOB_ID_RARITY_COEFFICIENTS;
-    double seed = rr_frand();
-    uint8_t id = 0;
-    for (; id < rr_mob_id_max - 1; ++id)
-        if (seed <= table[id])
-            break;
-    return id;
+    return rr_lower_bound(table, rr_mob_id_max - 1, RR_FRAND(spawn));
 }
 
 int should_spawn_at(uint8_t id, uint8_t rarity)
@@ -15,6 +15,8 @@
 
 #include <Shared/Bitset.h>
 
+#include <string.h>
+
 uint8_t rr_bitset_get_bit(uint8_t *a, uint64_t i)
 {
     // return a[i];
@@ -48,93 +50,78 @@ void rr_bitset_maybe_set(uint8_t *a, uint64_t i, uint8_t bit)
         rr_bitset_unset(a, i);
 }
 
-// void rr_bitset_for_each_bit(uint8_t *start, uint8_t *end, void *captures,
-//                             void (*cb)(uint64_t, void *))
-// {
-//     uint8_t *const original_start = start;
-//     uint64_t bitmapsize = (end - start) / sizeof(uint64_t);
-
-//     uint64_t bitset;
-//     for (uint64_t k = 0; k < bitmapsize; ++k)
-//     {
-//         bitset = bitmap[k];
-//         uint64_t p = k * 64;
-//         while (bitset != 0)
-//         {
-//             if (bitset & 0x1)
-//             {
-//                 cb(p, captures);
-//             }
-//             bitset >>= 1;
-//             p += 1;
-//         }
-//     }
-// }
-
-// void rr_bitset_for_each_bit(uint8_t *start, uint8_t *end, void *captures,
-// void (*cb)(uint64_t, void *))
-// {
-//     uint8_t *const original_start = start;
-
-//     while (start != end)
-//     {
-//         if ((start + 8 < end) && (uint64_t)start % 8 == 0)
-//         {
-//             uint64_t val = *(uint64_t *)start;
-//             while (val)
-//             {
-//                 uint64_t t = __builtin_ctzll(val);
-//                 cb(((start - original_start) << 3) | t, captures);
-//                 val &= val - 1; // clear the rightmost set bit
-//             }
-//             start += 8;
-//         }
-//         else
-//         {
-//             uint8_t val = *start;
-//             while (val)
-//             {
-//                 uint8_t t = __builtin_ctz(val);
-//                 cb(((start - original_start) << 3) | t, captures);
-//                 val &= val - 1; // clear the rightmost set bit
-//             }
-//             start++;
-//         }
-//     }
-// }
+// words are read with memcpy so the bitset doesn't need to be aligned. bit i
+// of byte n is bit 8n + i of the word on little endian targets (x86, wasm)
+static uint64_t load_word(uint8_t const *a)
+{
+    uint64_t word;
+    memcpy(&word, a, sizeof word);
+    return word;
+}
+
+static void store_word(uint8_t *a, uint64_t word)
+{
+    memcpy(a, &word, sizeof word);
+}
 
 void rr_bitset_for_each_bit(uint8_t *start, uint8_t *end, void *captures,
                             void (*cb)(uint64_t, void *))
 {
-    uint8_t *const original_start = start;
-
-    while (start != end)
+    uint64_t base = 0;
+    for (; end - start >= 8; start += 8, base += 64)
     {
-        if ((start + 8 < end) && (uint64_t)start % 8 == 0 &&
-            !*(uint64_t *)start)
+        uint64_t word = load_word(start);
+        while (word)
         {
-            start += 8;
-            continue;
+            cb(base | __builtin_ctzll(word), captures);
+            word &= word - 1; // clear the rightmost set bit
         }
-        if (*start)
+    }
+    for (; start != end; ++start, base += 8)
+    {
+        uint8_t byte = *start;
+        while (byte)
         {
-            if (*start & 1)
-                cb(((start - original_start) << 3) | 0, captures);
-            if (*start & 2)
-                cb(((start - original_start) << 3) | 1, captures);
-            if (*start & 4)
-                cb(((start - original_start) << 3) | 2, captures);
-            if (*start & 8)
-                cb(((start - original_start) << 3) | 3, captures);
-            if (*start & 16)
-                cb(((start - original_start) << 3) | 4, captures);
-            if (*start & 32)
-                cb(((start - original_start) << 3) | 5, captures);
-            if (*start & 64)
-                cb(((start - original_start) << 3) | 6, captures);
-            if (*start & 128)
-                cb(((start - original_start) << 3) | 7, captures);
+            cb(base | __builtin_ctz(byte), captures);
+            byte &= byte - 1;
         }
-        start++;
+    }
+}
+
+void rr_bitset_and(uint8_t *out, uint8_t const *a, uint8_t const *b,
+                   uint64_t size)
+{
+    uint64_t i = 0;
+    for (; i + 8 <= size; i += 8)
+        store_word(out + i, load_word(a + i) & load_word(b + i));
+    for (; i < size; ++i)
+        out[i] = a[i] & b[i];
+}
+
+void rr_bitset_and_not(uint8_t *out, uint8_t const *a, uint8_t const *b,
+                       uint64_t size)
+{
+    uint64_t i = 0;
+    for (; i + 8 <= size; i += 8)
+        store_word(out + i, load_word(a + i) & ~load_word(b + i));
+    for (; i < size; ++i)
+        out[i] = a[i] & ~b[i];
+}
+
+void rr_bitset_diff(uint8_t *added, uint8_t *removed, uint8_t const *before,
+                    uint8_t const *now, uint64_t size)
+{
+    uint64_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        uint64_t b = load_word(before + i);
+        uint64_t n = load_word(now + i);
+        store_word(added + i, n & ~b);
+        store_word(removed + i, b & ~n);
+    }
+    for (; i < size; ++i)
+    {
+        added[i] = now[i] & ~before[i];
+        removed[i] = before[i] & ~now[i];
     }
 }
@@ -29,7 +29,18 @@ uint8_t rr_bitset_get(uint8_t *, uint64_t);
 void rr_bitset_unset(uint8_t *, uint64_t);
 void rr_bitset_set(uint8_t *, uint64_t);
 void rr_bitset_maybe_set(uint8_t *, uint64_t, uint8_t);
+// Bits the callback changes in the 64 bits currently being visited are not
+// seen until the next call.
 void rr_bitset_for_each_bit(uint8_t *start, uint8_t *end, void *,
                             void (*cb)(uint64_t, void *));
 void rr_bitset_for_each_bit_until(uint8_t *start, uint8_t *end, void *,
                                   uint8_t (*cb)(uint64_t, void *));
+
+// Bulk operations, size is in bytes. out may alias either input.
+void rr_bitset_and(uint8_t *out, uint8_t const *, uint8_t const *, uint64_t);
+// out = a & ~b
+void rr_bitset_and_not(uint8_t *out, uint8_t const *a, uint8_t const *b,
+                       uint64_t);
+// added = now & ~before, removed = before & ~now in one pass
+void rr_bitset_diff(uint8_t *added, uint8_t *removed, uint8_t const *before,
+                    uint8_t const *now, uint64_t);
@@ -18,6 +18,7 @@
 #include <string.h>
 
 #include <Shared/Entity.h>
+#include <Shared/Random.h>
 #include <Shared/SimulationCommon.h>
 #include <Shared/Utilities.h>
 #include <Shared/pb.h>
@@ -27,7 +28,7 @@ void rr_component_ai_init(struct rr_component_ai *this,
 {
     memset(this, 0, sizeof *this);
     RR_SERVER_ONLY(this->ai_state = rr_ai_state_idle;)
-    RR_SERVER_ONLY(this->has_prediction = rr_frand() < 0.25;)
+    RR_SERVER_ONLY(this->has_prediction = RR_FRAND(ai) < 0.25;)
 }
 
 void rr_component_ai_free(struct rr_component_ai *this,
@@ -108,9 +108,9 @@ void rr_component_health_do_damage(struct rr_simulation *simulation,
     mob->squad_damage_counter[squad] += damage;
     struct rr_component_physical *physical =
         rr_simulation_get_physical(simulation, this->parent_id);
-    struct rr_simulation_animation *animation =
-        &simulation->animations[simulation->animation_length++];
-    animation->type = rr_animation_type_damagenumber;
+    struct rr_simulation_animation *animation = rr_simulation_add_animation(
+        simulation, rr_animation_type_damagenumber);
+    animation->arena = physical->arena;
     animation->x = physical->x;
     animation->y = physical->y;
     animation->damage = damage;
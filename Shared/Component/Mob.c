@@ -28,6 +28,7 @@
 #include <Server/EntityAllocation.h>
 #include <Server/Simulation.h>
 
+#include <Shared/Random.h>
 #include <Shared/StaticData.h>
 #include <Shared/Utilities.h>
 #endif
@@ -91,25 +92,11 @@ void rr_component_mob_free(struct rr_component_mob *this,
     {
         if (RR_MOB_DATA[this->id].loot[i].id == 0)
             break;
-        uint8_t id = RR_MOB_DATA[this->id].loot[i].id;
-        float seed = rr_frand();
-        float s2 = RR_MOB_DATA[this->id].loot[i].seed;
-        uint8_t drop;
+        float seed = RR_FRAND(drop);
         uint8_t cap = this->rarity >= rr_rarity_id_exotic ? this->rarity - 1
                                                           : this->rarity;
-
-        for (drop = 0; drop <= cap + 1; ++drop)
-        {
-            double end =
-                drop == cap + 1 ? 1 : RR_DROP_RARITY_COEFFICIENTS[drop];
-            if (cap < RR_PETAL_DATA[id].min_rarity)
-                end = 1;
-            else if (drop < RR_PETAL_DATA[id].min_rarity)
-                end = RR_DROP_RARITY_COEFFICIENTS[RR_PETAL_DATA[id].min_rarity];
-            if (seed <= pow(1 - (1 - end) * s2,
-                            RR_MOB_LOOT_RARITY_COEFFICIENTS[this->rarity]))
-                break;
-        }
+        uint8_t drop = rr_lower_bound(
+            RR_MOB_LOOT_TABLE[this->id][i][this->rarity], cap + 2, seed);
         if (drop == 0)
             continue;
         spawn_ids[count] = RR_MOB_DATA[this->id].loot[i].id;
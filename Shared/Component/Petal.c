@@ -27,6 +27,7 @@
 
 #include <Server/EntityAllocation.h>
 #include <Server/Simulation.h>
+#include <Shared/Random.h>
 #include <Shared/Utilities.h>
 #endif
 
@@ -47,7 +48,7 @@ void rr_component_petal_init(struct rr_component_petal *this,
                              struct rr_simulation *simulation)
 {
     memset(this, 0, sizeof *this);
-    RR_SERVER_ONLY(this->spin_ccw = 1 - 2 * (rand() & 1);)
+    RR_SERVER_ONLY(this->spin_ccw = 1 - 2 * RR_RAND_BELOW(misc, 2);)
 }
 
 void rr_component_petal_free(struct rr_component_petal *this,
@@ -61,6 +61,10 @@ struct rr_component_physical
     RR_CLIENT_ONLY(uint8_t deletion_type : 2;)
     RR_CLIENT_ONLY(uint8_t animation_started : 1;)
     RR_SERVER_ONLY(uint8_t protocol_state;)
+    // at rest with nothing touching it, the velocity system skips it and
+    // pairs of sleeping entities aren't tested for collision
+    RR_SERVER_ONLY(uint8_t sleeping;)
+    RR_SERVER_ONLY(uint8_t still_ticks;)
     EntityIdx parent_id;
     RR_SERVER_ONLY(EntityIdx arena;)
     RR_SERVER_ONLY(uint16_t colliding_with_size;)
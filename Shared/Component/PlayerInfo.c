@@ -127,8 +127,13 @@ void rr_component_player_info_petal_swap(struct rr_component_player_info *this,
     s_slot->rarity = temp;
 
     slot->count = RR_PETAL_DATA[slot->id].count[slot->rarity];
+    slot->reload_until =
+        simulation->ticks + RR_PETAL_DATA[slot->id].cooldown + 25;
     for (uint32_t i = 0; i < slot->count; ++i)
-        slot->petals[i].cooldown_ticks = RR_PETAL_DATA[slot->id].cooldown + 25;
+    {
+        slot->petals[i].reload_tick = slot->reload_until;
+        slot->petals[i].reload_scheduled = 0;
+    }
     this->protocol_state |= state_flags_petals;
 }
 
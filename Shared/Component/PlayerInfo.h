@@ -29,6 +29,8 @@
 #define RR_BASE_FOV (0.9f)
 #endif
 
+#define RR_MAX_DROPS_PER_TICK (8)
+
 struct rr_simulation;
 struct proto_bug;
 RR_SERVER_ONLY(struct rr_squad_member;)
@@ -37,7 +39,9 @@ RR_CLIENT_ONLY(struct rr_renderer;)
 struct rr_component_player_info_petal
 {
     EntityHash entity_hash;
-    int32_t cooldown_ticks;
+    // simulation tick the petal comes back on once it's gone
+    uint32_t reload_tick;
+    uint8_t reload_scheduled;
 };
 
 struct rr_component_player_info_petal_slot
@@ -47,6 +51,15 @@ struct rr_component_player_info_petal_slot
     uint8_t rarity;
     uint8_t client_cooldown;
     RR_SERVER_ONLY(uint8_t count;)
+    // latest reload_tick queued for any of the petals
+    RR_SERVER_ONLY(uint32_t reload_until;)
+};
+
+struct rr_drop_pickup
+{
+    uint8_t id;
+    uint8_t rarity;
+    uint8_t count;
 };
 
 struct rr_player_info_modifiers
@@ -82,10 +95,10 @@ struct rr_component_player_info
     uint8_t squad;
     uint8_t slot_count;
     RR_SERVER_ONLY(uint8_t *entities_in_view;)
-    RR_SERVER_ONLY(struct rr_id_rarity_pair
-                       drops_this_tick[8];) // yes, it's limited to 8. if the
-                                            // player poicks up more than that
-                                            // then it waits until the next tick
+    // identical drops share a slot. once all slots are taken the rest of the
+    // drops wait until the next tick
+    RR_SERVER_ONLY(struct rr_drop_pickup
+                       drops_this_tick[RR_MAX_DROPS_PER_TICK];)
     RR_SERVER_ONLY(uint8_t drops_this_tick_size;)
 };
 
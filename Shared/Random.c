@@ -0,0 +1,62 @@
+// Copyright (C) 2024  Paul Johnson
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include <Shared/Random.h>
+
+#define RR_RANDOM_DEFAULT_STATE 0x853c49e6748fea9bull
+#define RR_RANDOM_DEFAULT_STREAM(ID) {RR_RANDOM_DEFAULT_STATE, ((ID) << 1) | 1}
+
+struct rr_random RR_RANDOM_STREAMS[rr_random_stream_id_max] = {
+    RR_RANDOM_DEFAULT_STREAM(rr_random_stream_id_misc),
+    RR_RANDOM_DEFAULT_STREAM(rr_random_stream_id_ai),
+    RR_RANDOM_DEFAULT_STREAM(rr_random_stream_id_spawn),
+    RR_RANDOM_DEFAULT_STREAM(rr_random_stream_id_drop),
+    RR_RANDOM_DEFAULT_STREAM(rr_random_stream_id_craft),
+};
+
+void rr_random_seed(struct rr_random *this, uint64_t seed, uint64_t stream)
+{
+    this->state = 0;
+    this->increment = (stream << 1) | 1;
+    rr_random_next(this);
+    this->state += seed;
+    rr_random_next(this);
+}
+
+void rr_random_seed_streams(uint64_t seed)
+{
+    for (uint64_t i = 0; i < rr_random_stream_id_max; ++i)
+        rr_random_seed(&RR_RANDOM_STREAMS[i], seed, i);
+}
+
+uint32_t rr_random_next(struct rr_random *this)
+{
+    uint64_t old = this->state;
+    this->state = old * 6364136223846793005ull + this->increment;
+    uint32_t xorshifted = ((old >> 18) ^ old) >> 27;
+    uint32_t rot = old >> 59;
+    return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+}
+
+float rr_random_float(struct rr_random *this)
+{
+    // top 24 bits so the result is exactly representable and never hits 1
+    return (rr_random_next(this) >> 8) * (1.0f / 16777216.0f);
+}
+
+uint32_t rr_random_below(struct rr_random *this, uint32_t bound)
+{
+    return ((uint64_t)rr_random_next(this) * bound) >> 32;
+}
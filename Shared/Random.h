@@ -0,0 +1,53 @@
+// Copyright (C) 2024  Paul Johnson
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as
+// published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU Affero General Public License for more details.
+
+// You should have received a copy of the GNU Affero General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <stdint.h>
+
+// pcg32. every stream has its own increment so the sequences are independent
+// of each other, and nothing here takes a lock the way libc rand() does
+struct rr_random
+{
+    uint64_t state;
+    uint64_t increment;
+};
+
+enum rr_random_stream_id
+{
+    rr_random_stream_id_misc,
+    rr_random_stream_id_ai,
+    rr_random_stream_id_spawn,
+    rr_random_stream_id_drop,
+    rr_random_stream_id_craft,
+    rr_random_stream_id_max
+};
+
+extern struct rr_random RR_RANDOM_STREAMS[rr_random_stream_id_max];
+
+#define RR_RANDOM_STREAM(NAME) (&RR_RANDOM_STREAMS[rr_random_stream_id_##NAME])
+#define RR_FRAND(NAME) rr_random_float(RR_RANDOM_STREAM(NAME))
+#define RR_RAND_BELOW(NAME, BOUND)                                             \
+    rr_random_below(RR_RANDOM_STREAM(NAME), BOUND)
+
+void rr_random_seed(struct rr_random *, uint64_t, uint64_t);
+// seeds every global stream from one seed. same seed, same game
+void rr_random_seed_streams(uint64_t);
+
+uint32_t rr_random_next(struct rr_random *);
+// [0, 1)
+float rr_random_float(struct rr_random *);
+// [0, bound)
+uint32_t rr_random_below(struct rr_random *, uint32_t);
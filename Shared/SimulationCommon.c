@@ -79,6 +79,38 @@ void rr_simulation_create_component_vectors(struct rr_simulation *this)
     }
 }
 
+#ifdef RR_SERVER
+struct rr_simulation_animation *
+rr_simulation_add_animation(struct rr_simulation *this, uint8_t type)
+{
+    if (this->animation_length == this->animation_capacity)
+    {
+        this->animation_capacity =
+            this->animation_capacity == 0 ? 64 : this->animation_capacity * 2;
+        this->animations =
+            realloc(this->animations,
+                    this->animation_capacity * sizeof *this->animations);
+    }
+    struct rr_simulation_animation *animation =
+        &this->animations[this->animation_length++];
+    memset(animation, 0, sizeof *animation);
+    animation->type = type;
+    return animation;
+}
+#endif
+
+void rr_simulation_clear_pages(struct rr_simulation *this)
+{
+#define XX(COMPONENT, ID)                                                      \
+    for (uint32_t page = 0; page < RR_COMPONENT_PAGE_COUNT; ++page)            \
+        if (this->COMPONENT##_pages[page] != NULL)                             \
+            memset(this->COMPONENT##_pages[page], 0,                           \
+                   RR_COMPONENT_PAGE_SIZE *                                    \
+                       sizeof *this->COMPONENT##_pages[page]);
+    RR_FOR_EACH_COMPONENT;
+#undef XX
+}
+
 void rr_simulation_for_each_entity(struct rr_simulation *this,
                                    void *user_captures,
                                    void (*cb)(EntityIdx, void *))
@@ -105,22 +137,32 @@ void rr_simulation_for_each_entity(struct rr_simulation *this,
         assert(rr_simulation_has_entity(this, entity));                        \
         return (this->entity_tracker[entity] >> ID) & 1;                       \
     }                                                                          \
+    struct rr_component_##COMPONENT *rr_simulation_reserve_##COMPONENT(        \
+        struct rr_simulation *this, EntityIdx entity)                          \
+    {                                                                          \
+        struct rr_component_##COMPONENT **page =                               \
+            &this->COMPONENT##_pages[entity >> RR_COMPONENT_PAGE_SHIFT];       \
+        if (*page == NULL)                                                     \
+            *page = calloc(RR_COMPONENT_PAGE_SIZE, sizeof **page);             \
+        return RR_SIMULATION_COMPONENT(this, COMPONENT, entity);               \
+    }                                                                          \
     struct rr_component_##COMPONENT *rr_simulation_add_##COMPONENT(            \
         struct rr_simulation *this, EntityIdx entity)                          \
     {                                                                          \
         assert(rr_simulation_has_entity(this, entity));                        \
+        struct rr_component_##COMPONENT *component =                           \
+            rr_simulation_reserve_##COMPONENT(this, entity);                   \
         this->entity_tracker[entity] |= (1 << ID);                             \
-        rr_component_##COMPONENT##_init(&this->COMPONENT##_components[entity], \
-                                        this);                                 \
-        this->COMPONENT##_components[entity].parent_id = entity;               \
+        rr_component_##COMPONENT##_init(component, this);                      \
+        component->parent_id = entity;                                         \
         this->COMPONENT##_vector[this->COMPONENT##_count++] = entity;          \
-        return rr_simulation_get_##COMPONENT(this, entity);                    \
+        return component;                                                      \
     }                                                                          \
     struct rr_component_##COMPONENT *rr_simulation_get_##COMPONENT(            \
         struct rr_simulation *this, EntityIdx entity)                          \
     {                                                                          \
         assert(rr_simulation_has_##COMPONENT(this, entity));                   \
-        return &this->COMPONENT##_components[entity];                          \
+        return RR_SIMULATION_COMPONENT(this, COMPONENT, entity);               \
     }
 RR_FOR_EACH_COMPONENT;
 #undef XX
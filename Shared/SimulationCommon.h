@@ -33,6 +33,7 @@
 #ifdef RR_SERVER
 #include <Shared/Vector.h>
 struct rr_spatial_hash;
+struct rr_petal_reload_wheel;
 #endif
 
 struct rr_simulation_animation
@@ -41,6 +42,10 @@ struct rr_simulation_animation
 #ifdef RR_CLIENT
     float opacity;
     uint32_t color;
+#endif
+#ifdef RR_SERVER
+    // only clients looking at this arena get sent the event
+    EntityIdx arena;
 #endif
     union
     {
@@ -67,6 +72,18 @@ struct rr_simulation_animation
     };
 };
 
+// components live in pages of RR_COMPONENT_PAGE_SIZE entities which are only
+// allocated once an entity in their range gets that component. pages never
+// move so component pointers stay valid until the simulation is freed
+#define RR_COMPONENT_PAGE_SHIFT (8)
+#define RR_COMPONENT_PAGE_SIZE (1 << RR_COMPONENT_PAGE_SHIFT)
+#define RR_COMPONENT_PAGE_COUNT (RR_MAX_ENTITY_COUNT >> RR_COMPONENT_PAGE_SHIFT)
+
+// unchecked, the entity has to have the component
+#define RR_SIMULATION_COMPONENT(SIMULATION, COMPONENT, ENTITY)                 \
+    (&(SIMULATION)->COMPONENT##_pages[(ENTITY) >> RR_COMPONENT_PAGE_SHIFT]     \
+                                     [(ENTITY) & (RR_COMPONENT_PAGE_SIZE - 1)])
+
 enum rr_simulation_team_id
 {
     rr_simulation_team_id_mobs,
@@ -83,13 +100,18 @@ struct rr_simulation
 
 #define XX(COMPONENT, ID)                                                      \
     struct rr_component_##COMPONENT                                            \
-        COMPONENT##_components[RR_MAX_ENTITY_COUNT];                           \
+        *COMPONENT##_pages[RR_COMPONENT_PAGE_COUNT];                           \
     EntityIdx COMPONENT##_vector[RR_MAX_ENTITY_COUNT];                         \
     EntityIdx COMPONENT##_count;
     RR_FOR_EACH_COMPONENT;
 #undef XX
-    RR_SERVER_ONLY(struct rr_simulation_animation animations[16384];)
+    // events for this tick, the buffer is kept and grown across ticks
+    RR_SERVER_ONLY(struct rr_simulation_animation *animations;)
     RR_SERVER_ONLY(uint32_t animation_length;)
+    RR_SERVER_ONLY(uint32_t animation_capacity;)
+    RR_SERVER_ONLY(uint32_t ticks;)
+    RR_SERVER_ONLY(uint32_t sleeping_count;)
+    RR_SERVER_ONLY(struct rr_petal_reload_wheel *petal_reloads;)
     RR_CLIENT_ONLY(uint8_t updated_this_tick;)
     uint8_t game_over;
 };
@@ -100,6 +122,9 @@ void rr_simulation_request_entity_deletion(struct rr_simulation *, EntityIdx);
 void rr_simulation_for_each_entity(struct rr_simulation *, void *,
                                    void (*)(EntityIdx, void *));
 void rr_simulation_create_component_vectors(struct rr_simulation *);
+void rr_simulation_clear_pages(struct rr_simulation *);
+RR_SERVER_ONLY(struct rr_simulation_animation *rr_simulation_add_animation(
+                   struct rr_simulation *, uint8_t);)
 
 // internal use
 void __rr_simulation_pending_deletion_free_components(uint64_t, void *);
@@ -109,6 +134,8 @@ void __rr_simulation_pending_deletion_unset_entity(uint64_t, void *);
     uint8_t rr_simulation_has_##COMPONENT(struct rr_simulation *, EntityIdx);  \
     struct rr_component_##COMPONENT *rr_simulation_add_##COMPONENT(            \
         struct rr_simulation *, EntityIdx);                                    \
+    struct rr_component_##COMPONENT *rr_simulation_reserve_##COMPONENT(        \
+        struct rr_simulation *, EntityIdx);                                    \
     struct rr_component_##COMPONENT *rr_simulation_get_##COMPONENT(            \
         struct rr_simulation *, EntityIdx);                                    \
     void rr_simulation_for_each_##COMPONENT(struct rr_simulation *, void *,    \
@@ -17,6 +17,7 @@
 
 #include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #include <Shared/Utilities.h>
 
@@ -267,6 +268,52 @@ static void init_game_coefficients()
     }
 }
 
+#ifdef RR_SERVER
+double RR_SPAWN_RARITY_TABLE[RR_SPAWN_DIFFICULTY_MAX *
+                                 RR_SPAWN_DIFFICULTY_STEPS +
+                             1][rr_rarity_id_max];
+double RR_MOB_LOOT_TABLE[rr_mob_id_max][4][rr_rarity_id_max][rr_rarity_id_max];
+
+static void init_spawn_tables()
+{
+    for (uint32_t row = 0;
+         row <= RR_SPAWN_DIFFICULTY_MAX * RR_SPAWN_DIFFICULTY_STEPS; ++row)
+    {
+        double exponent = pow(1.5, (double)row / RR_SPAWN_DIFFICULTY_STEPS);
+        for (uint32_t rarity = 0; rarity < rr_rarity_id_max; ++rarity)
+            RR_SPAWN_RARITY_TABLE[row][rarity] = pow(
+                1 - (1 - RR_MOB_WAVE_RARITY_COEFFICIENTS[rarity + 1]) * 0.3,
+                exponent);
+    }
+    for (uint32_t mob = 0; mob < rr_mob_id_max; ++mob)
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            uint8_t id = RR_MOB_DATA[mob].loot[i].id;
+            if (id == 0)
+                break;
+            double seed = RR_MOB_DATA[mob].loot[i].seed;
+            for (uint32_t rarity = 0; rarity < rr_rarity_id_max; ++rarity)
+            {
+                uint32_t cap =
+                    rarity >= rr_rarity_id_exotic ? rarity - 1 : rarity;
+                for (uint32_t drop = 0; drop <= cap + 1; ++drop)
+                {
+                    double end =
+                        drop == cap + 1 ? 1 : RR_DROP_RARITY_COEFFICIENTS[drop];
+                    if (cap < RR_PETAL_DATA[id].min_rarity)
+                        end = 1;
+                    else if (drop < RR_PETAL_DATA[id].min_rarity)
+                        end = RR_DROP_RARITY_COEFFICIENTS[RR_PETAL_DATA[id]
+                                                              .min_rarity];
+                    RR_MOB_LOOT_TABLE[mob][i][rarity][drop] =
+                        pow(1 - (1 - end) * seed,
+                            RR_MOB_LOOT_RARITY_COEFFICIENTS[rarity]);
+                }
+            }
+        }
+}
+#endif
+
 #define offset(a, b)                                                           \
     ((x + a < 0 || y + b < 0 || x + a >= size / 2 || y + b >= size / 2)        \
          ? 0                                                                   \
@@ -408,6 +455,84 @@ double RR_BASE_CRAFT_CHANCES[rr_rarity_id_max - 1] = {0.5,  0.3,  0.15,  0.05,
                                                       0.03, 0.02, 0.015, 0.8};
 double RR_CRAFT_CHANCES[rr_rarity_id_max - 1];
 
+#ifdef RR_SERVER
+double RR_CRAFT_FAIL_HAZARD[rr_rarity_id_max - 1][RR_CRAFT_MAX_ATTEMPTS + 1];
+uint32_t RR_CRAFT_PITY_CAP[rr_rarity_id_max - 1];
+
+static void init_craft_tables()
+{
+    for (uint32_t r = 0; r < rr_rarity_id_max - 1; ++r)
+    {
+        uint32_t n = 0;
+        RR_CRAFT_FAIL_HAZARD[r][0] = 0;
+        while (RR_CRAFT_CHANCES[r] * ++n < 1 && n < RR_CRAFT_MAX_ATTEMPTS)
+            RR_CRAFT_FAIL_HAZARD[r][n] =
+                RR_CRAFT_FAIL_HAZARD[r][n - 1] -
+                log1p(-RR_CRAFT_CHANCES[r] * n);
+        RR_CRAFT_FAIL_HAZARD[r][n] = INFINITY;
+        RR_CRAFT_PITY_CAP[r] = n;
+    }
+}
+
+#define CLEARANCE_WINDOW (2)
+
+// distance to the nearest tile that isn't open floor per biome, sampled
+// RR_MAZE_CLEARANCE_RESOLUTION times per tile along each axis
+static float *RR_MAZE_CLEARANCE[rr_biome_id_max];
+
+static float *init_maze_clearance(struct rr_maze_declaration const *decl)
+{
+    uint32_t dim = decl->maze_dim;
+    uint32_t samples = dim * RR_MAZE_CLEARANCE_RESOLUTION;
+    float spacing = decl->grid_size / RR_MAZE_CLEARANCE_RESOLUTION;
+    float extent = dim * decl->grid_size;
+    float *clearance = malloc(samples * samples * sizeof *clearance);
+    for (uint32_t sy = 0; sy < samples; ++sy)
+        for (uint32_t sx = 0; sx < samples; ++sx)
+        {
+            float px = (sx + 0.5f) * spacing;
+            float py = (sy + 0.5f) * spacing;
+            float best = CLEARANCE_WINDOW * decl->grid_size;
+            best = fminf(best, fminf(fminf(px, extent - px),
+                                     fminf(py, extent - py)));
+            // anything past the window is at least CLEARANCE_WINDOW tiles away
+            int32_t tx = sx / RR_MAZE_CLEARANCE_RESOLUTION;
+            int32_t ty = sy / RR_MAZE_CLEARANCE_RESOLUTION;
+            for (int32_t gy = ty - CLEARANCE_WINDOW;
+                 gy <= ty + CLEARANCE_WINDOW; ++gy)
+                for (int32_t gx = tx - CLEARANCE_WINDOW;
+                     gx <= tx + CLEARANCE_WINDOW; ++gx)
+                {
+                    if (gx < 0 || gy < 0 || gx >= dim || gy >= dim)
+                        continue;
+                    if (decl->maze[gy * dim + gx].value == 1)
+                        continue;
+                    float dx = fmaxf(fmaxf(gx * decl->grid_size - px, 0),
+                                     px - (gx + 1) * decl->grid_size);
+                    float dy = fmaxf(fmaxf(gy * decl->grid_size - py, 0),
+                                     py - (gy + 1) * decl->grid_size);
+                    best = fminf(best, sqrtf(dx * dx + dy * dy));
+                }
+            clearance[sy * samples + sx] = best;
+        }
+    return clearance;
+}
+
+float rr_maze_clearance(struct rr_maze_declaration const *decl, float x,
+                        float y)
+{
+    uint32_t samples = decl->maze_dim * RR_MAZE_CLEARANCE_RESOLUTION;
+    float spacing = decl->grid_size / RR_MAZE_CLEARANCE_RESOLUTION;
+    if (x < 0 || y < 0 || x >= samples * spacing || y >= samples * spacing)
+        return 0;
+    uint32_t sx = x / spacing;
+    uint32_t sy = y / spacing;
+    // the sample is at the center of the cell, at most half a diagonal away
+    return RR_MAZE_CLEARANCE[decl - RR_MAZES][sy * samples + sx] -
+           spacing * 0.70711f;
+}
+#endif
+
 static double from_prd_base(double C)
 {
     double pProcOnN = 0;
@@ -461,6 +586,17 @@ void rr_static_data_init()
     init(HELL_CREEK);
     init(BURROW);
 #ifdef RR_SERVER
+    init_spawn_tables();
+    init_craft_tables();
+    for (uint32_t i = 0; i < rr_biome_id_max; ++i)
+    {
+        // biomes can share a maze
+        for (uint32_t j = 0; j < i; ++j)
+            if (RR_MAZES[j].maze == RR_MAZES[i].maze)
+                RR_MAZE_CLEARANCE[i] = RR_MAZE_CLEARANCE[j];
+        if (RR_MAZE_CLEARANCE[i] == NULL)
+            RR_MAZE_CLEARANCE[i] = init_maze_clearance(&RR_MAZES[i]);
+    }
     print_chances(52);
     print_chances(44);
     print_chances(40);
@@ -51,7 +51,8 @@ enum rr_clientbound_packet_header
     rr_clientbound_squad_fail,
     rr_clientbound_squad_leave,
     rr_clientbound_account_result,
-    rr_clientbound_craft_result
+    rr_clientbound_craft_result,
+    rr_clientbound_squad_update
 };
 
 #define RR_SLOT_COUNT_FROM_LEVEL(level) (level < 100 ? 5 + (level) / 20 : 10)
@@ -204,6 +205,22 @@ extern uint32_t RR_MOB_DIFFICULTY_COEFFICIENTS[rr_mob_id_max];
 extern double RR_HELL_CREEK_MOB_ID_RARITY_COEFFICIENTS[rr_mob_id_max];
 extern double RR_GARDEN_MOB_ID_RARITY_COEFFICIENTS[rr_mob_id_max];
 
+#ifdef RR_SERVER
+// spawn rarity thresholds are tabulated every 1 / RR_SPAWN_DIFFICULTY_STEPS of
+// a difficulty level and blended between rows. anything harder than the max
+// uses the last row
+#define RR_SPAWN_DIFFICULTY_MAX 80
+#define RR_SPAWN_DIFFICULTY_STEPS 32
+
+extern double RR_SPAWN_RARITY_TABLE[RR_SPAWN_DIFFICULTY_MAX *
+                                        RR_SPAWN_DIFFICULTY_STEPS +
+                                    1][rr_rarity_id_max];
+// cumulative chance per (mob, loot slot, mob rarity). index 0 is no drop,
+// index n is a drop of rarity n - 1
+extern double RR_MOB_LOOT_TABLE[rr_mob_id_max][4][rr_rarity_id_max]
+                               [rr_rarity_id_max];
+#endif
+
 extern uint32_t RR_RARITY_COLORS[rr_rarity_id_max];
 extern char const *RR_RARITY_NAMES[rr_rarity_id_max];
 
@@ -250,6 +267,25 @@ extern uint8_t RR_GLOBAL_BIOME;
 extern double RR_BASE_CRAFT_CHANCES[rr_rarity_id_max - 1];
 extern double RR_CRAFT_CHANCES[rr_rarity_id_max - 1];
 
+#ifdef RR_SERVER
+// the pity counter guarantees a success within this many attempts for every
+// rarity (the worst one needs ~2900)
+#define RR_CRAFT_MAX_ATTEMPTS 4096
+
+// RR_CRAFT_FAIL_HAZARD[rarity][n] is -log of the chance that the first n
+// attempts after a success all fail. kept in log space because that chance
+// underflows long before the pity cap. infinite at RR_CRAFT_PITY_CAP[rarity]
+extern double RR_CRAFT_FAIL_HAZARD[rr_rarity_id_max - 1]
+                                  [RR_CRAFT_MAX_ATTEMPTS + 1];
+extern uint32_t RR_CRAFT_PITY_CAP[rr_rarity_id_max - 1];
+
+#define RR_MAZE_CLEARANCE_RESOLUTION (4)
+
+// lower bound on the distance from (x, y) to any wall, water or curved tile
+// or the edge of the maze. capped at two tiles. only for mazes in RR_MAZES
+float rr_maze_clearance(struct rr_maze_declaration const *, float, float);
+#endif
+
 void rr_static_data_init();
 
 double xp_to_reach_level(uint32_t);
@@ -19,6 +19,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <Shared/Random.h>
+
 void rr_log_hex(uint8_t *start, uint8_t *end)
 {
     while (start != end)
@@ -51,7 +53,14 @@ float rr_angle_lerp(float start, float end, float t)
     }
 }
 
-float rr_frand() { return (double)rand() / ((double)RAND_MAX + 1.0); }
+uint32_t rr_zigzag_encode(int32_t v)
+{
+    return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+int32_t rr_zigzag_decode(uint32_t v) { return (v >> 1) ^ -(int32_t)(v & 1); }
+
+float rr_frand() { return RR_FRAND(misc); }
 
 float rr_fclamp(float v, float s, float e)
 {
@@ -62,6 +71,23 @@ float rr_fclamp(float v, float s, float e)
     return v;
 }
 
+uint32_t rr_lower_bound(double const *table, uint32_t length, double key)
+{
+    uint32_t start = 0;
+    while (length > 0)
+    {
+        uint32_t half = length >> 1;
+        if (table[start + half] < key)
+        {
+            start += half + 1;
+            length -= half + 1;
+        }
+        else
+            length = half;
+    }
+    return start;
+}
+
 int rr_angle_within(float a1, float a2, float within)
 {
     float diff = fmod(fmod(a1 - a2, 2 * M_PI) + 2 * M_PI, 2 * M_PI);
@@ -43,7 +43,12 @@ float rr_angle_lerp(float, float, float);
 int rr_angle_within(float, float, float);
 float rr_frand();
 float rr_fclamp(float, float, float);
+// first index whose value is >= the key, or the length if there is none
+uint32_t rr_lower_bound(double const *, uint32_t, double);
 char *rr_sprintf(char *, double);
+// signed values as varuints, small magnitudes stay small
+uint32_t rr_zigzag_encode(int32_t);
+int32_t rr_zigzag_decode(uint32_t);
 
 int rr_base_64_decode(char *, const char *);
 int rr_base_64_encode(char *, const char *, int);